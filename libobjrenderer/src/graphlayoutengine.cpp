@@ -0,0 +1,734 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2015 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "graphlayoutengine.h"
+#include "schemaview.h"
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <cmath>
+
+GraphLayoutEngine::GraphLayoutEngine(void)
+{
+	obj_spacing=50;
+	tabs_per_row=5;
+	sch_per_row=3;
+}
+
+void GraphLayoutEngine::setObjectSpacing(float spacing)
+{
+	obj_spacing=(spacing < 0 ? 0 : spacing);
+}
+
+void GraphLayoutEngine::setTablesPerRow(unsigned count)
+{
+	tabs_per_row=(count==0 ? 1 : count);
+}
+
+void GraphLayoutEngine::setSchemasPerRow(unsigned count)
+{
+	sch_per_row=(count==0 ? 1 : count);
+}
+
+vector<GraphLayoutEngine::SchemaGraph> GraphLayoutEngine::buildGraphs(DatabaseModel *model)
+{
+	vector<SchemaGraph> graphs;
+	vector<BaseObject *> tables, views, rels;
+	map<BaseTable *, pair<unsigned, unsigned>> nodes_idx;
+	BaseTableView *tab_view=nullptr;
+	BaseRelationship *rel=nullptr;
+	BaseTable *tabs[2];
+	Schema *schema=nullptr;
+
+	for(auto &obj : *model->getObjectList(OBJ_SCHEMA))
+	{
+		SchemaGraph graph;
+
+		schema=dynamic_cast<Schema *>(obj);
+		tables=model->getObjects(OBJ_TABLE, schema);
+		views=model->getObjects(OBJ_VIEW, schema);
+		tables.insert(tables.end(), views.begin(), views.end());
+
+		graph.schema=schema;
+
+		for(auto &tab : tables)
+		{
+			tab_view=dynamic_cast<BaseTableView *>(dynamic_cast<BaseTable *>(tab)->getReceiverObject());
+
+			if(tab_view)
+			{
+				LayoutNode node;
+
+				node.view=tab_view;
+				node.size=tab_view->boundingRect().size();
+				nodes_idx[dynamic_cast<BaseTable *>(tab)]=make_pair(graphs.size(), graph.nodes.size());
+				graph.nodes.push_back(node);
+			}
+		}
+
+		if(!graph.nodes.empty())
+			graphs.push_back(graph);
+	}
+
+	//Creating the edges between the tables of the same schema
+	rels=*model->getObjectList(OBJ_RELATIONSHIP);
+	rels.insert(rels.end(), model->getObjectList(BASE_RELATIONSHIP)->begin(), model->getObjectList(BASE_RELATIONSHIP)->end());
+
+	for(auto &obj : rels)
+	{
+		rel=dynamic_cast<BaseRelationship *>(obj);
+
+		if(rel->isSelfRelationship())
+			continue;
+
+		tabs[0]=rel->getTable(BaseRelationship::SRC_TABLE);
+		tabs[1]=rel->getTable(BaseRelationship::DST_TABLE);
+
+		if(nodes_idx.count(tabs[0]) && nodes_idx.count(tabs[1]) &&
+			 nodes_idx[tabs[0]].first==nodes_idx[tabs[1]].first)
+		{
+			graphs[nodes_idx[tabs[0]].first].edges.push_back(make_pair(nodes_idx[tabs[0]].second,
+																																	nodes_idx[tabs[1]].second));
+		}
+	}
+
+	return(graphs);
+}
+
+vector<unsigned> GraphLayoutEngine::sortSchemas(DatabaseModel *model, vector<SchemaGraph> &graphs)
+{
+	map<BaseObject *, unsigned> sch_idx;
+	vector<vector<unsigned>> weights(graphs.size(), vector<unsigned>(graphs.size(), 0));
+	vector<unsigned> order, links(graphs.size(), 0);
+	vector<bool> placed(graphs.size(), false);
+	vector<BaseObject *> rels;
+	BaseRelationship *rel=nullptr;
+	BaseObject *schs[2];
+	unsigned i, best;
+
+	for(i=0; i < graphs.size(); i++)
+		sch_idx[graphs[i].schema]=i;
+
+	//Counting the relationships between each pair of schemas
+	rels=*model->getObjectList(OBJ_RELATIONSHIP);
+	rels.insert(rels.end(), model->getObjectList(BASE_RELATIONSHIP)->begin(), model->getObjectList(BASE_RELATIONSHIP)->end());
+
+	for(auto &obj : rels)
+	{
+		rel=dynamic_cast<BaseRelationship *>(obj);
+		schs[0]=rel->getTable(BaseRelationship::SRC_TABLE)->getSchema();
+		schs[1]=rel->getTable(BaseRelationship::DST_TABLE)->getSchema();
+
+		if(schs[0]!=schs[1] && sch_idx.count(schs[0]) && sch_idx.count(schs[1]))
+		{
+			weights[sch_idx[schs[0]]][sch_idx[schs[1]]]++;
+			weights[sch_idx[schs[1]]][sch_idx[schs[0]]]++;
+		}
+	}
+
+	/* Greedy ordering: starts from the biggest schema and appends, each time, the schema
+	with more relationships to the already placed ones (ties resolved by the schema size) */
+	while(order.size() < graphs.size())
+	{
+		best=graphs.size();
+
+		for(i=0; i < graphs.size(); i++)
+		{
+			if(placed[i]) continue;
+
+			if(best==graphs.size() || links[i] > links[best] ||
+				 (links[i]==links[best] && graphs[i].nodes.size() > graphs[best].nodes.size()))
+				best=i;
+		}
+
+		placed[best]=true;
+		order.push_back(best);
+
+		for(i=0; i < graphs.size(); i++)
+			links[i]+=weights[best][i];
+	}
+
+	return(order);
+}
+
+void GraphLayoutEngine::rearrangeObjects(DatabaseModel *model, const QPointF &origin)
+{
+	if(!model)
+		throw Exception(ERR_OPR_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	vector<SchemaGraph> graphs=buildGraphs(model);
+	vector<unsigned> order;
+	unsigned thread_cnt=std::max<unsigned>(1, std::thread::hardware_concurrency()), sch_id=0;
+	float x=origin.x(), y=origin.y(), max_y=-1, cy=0;
+	SchemaView *sch_view=nullptr;
+
+	if(graphs.size()==1)
+		//A single schema uses all the threads to calculate the forces
+		arrangeGraph(graphs[0], thread_cnt);
+	else if(!graphs.empty())
+	{
+		//Several schemas are arranged in parallel, one schema per thread at time
+		vector<std::thread> threads;
+		std::atomic<unsigned> next_graph(0);
+		auto arrange_next=[&](){
+			unsigned idx;
+
+			while((idx=next_graph++) < graphs.size())
+				arrangeGraph(graphs[idx], 1);
+		};
+
+		thread_cnt=std::min<unsigned>(thread_cnt, graphs.size());
+
+		for(unsigned i=0; i < thread_cnt; i++)
+			threads.push_back(std::thread(arrange_next));
+
+		for(auto &thread : threads)
+			thread.join();
+	}
+
+	order=sortSchemas(model, graphs);
+
+	//Moving the graphical objects (on the main thread) and placing the schemas in rows
+	for(auto &idx : order)
+	{
+		SchemaGraph &graph=graphs[idx];
+
+		for(auto &node : graph.nodes)
+			node.view->setPos(QPointF(x + node.pos.x(), y + node.pos.y()));
+
+		graph.schema->setRectVisible(true);
+		graph.schema->setModified(true);
+		sch_view=dynamic_cast<SchemaView *>(graph.schema->getReceiverObject());
+
+		if(sch_view)
+			cy=sch_view->pos().y() + sch_view->boundingRect().height();
+		else
+			cy=y + graph.size.height();
+
+		//Defining the maximum y position to avoid schema boxes colliding vertically
+		if(max_y < cy)
+			max_y=cy;
+
+		sch_id++;
+
+		//It the current schema is the last of it`s row
+		if(sch_id >= sch_per_row)
+		{
+			sch_id=0;
+			y=max_y + obj_spacing;
+			x=origin.x();
+			max_y=-1;
+		}
+		else if(sch_view)
+			x=sch_view->pos().x() + sch_view->boundingRect().width() + obj_spacing;
+		else
+			x+=graph.size.width() + obj_spacing;
+	}
+
+	//Schemas without tables/views only have their rectangles updated
+	for(auto &obj : *model->getObjectList(OBJ_SCHEMA))
+	{
+		Schema *schema=dynamic_cast<Schema *>(obj);
+		bool has_graph=false;
+
+		for(auto &graph : graphs)
+		{
+			if(graph.schema==schema)
+			{
+				has_graph=true;
+				break;
+			}
+		}
+
+		if(!has_graph)
+		{
+			schema->setRectVisible(true);
+			schema->setModified(true);
+		}
+	}
+}
+
+void GraphLayoutEngine::arrangeGraph(SchemaGraph &graph, unsigned thread_cnt)
+{
+	unsigned count=graph.nodes.size(), i, root, other;
+	vector<unsigned> parent(count), comp_idx(count, count), local_idx(count);
+	vector<vector<LayoutNode *>> comps, blocks;
+	vector<vector<pair<unsigned, unsigned>>> comp_edges;
+	vector<LayoutNode *> isolated;
+	vector<QSizeF> blocks_size;
+	double total_area=0, row_width=0, x=0, y=0, row_h=0, max_x=0;
+
+	//Grouping the nodes by connected components (union-find)
+	for(i=0; i < count; i++)
+		parent[i]=i;
+
+	auto find_root=[&](unsigned idx){
+		while(parent[idx]!=idx)
+		{
+			parent[idx]=parent[parent[idx]];
+			idx=parent[idx];
+		}
+		return(idx);
+	};
+
+	for(auto &edge : graph.edges)
+	{
+		root=find_root(edge.first);
+		other=find_root(edge.second);
+
+		if(root!=other)
+			parent[std::max(root, other)]=std::min(root, other);
+	}
+
+	for(i=0; i < count; i++)
+	{
+		root=find_root(i);
+
+		if(comp_idx[root]==count)
+		{
+			comp_idx[root]=comps.size();
+			comps.push_back(vector<LayoutNode *>());
+			comp_edges.push_back(vector<pair<unsigned, unsigned>>());
+		}
+
+		local_idx[i]=comps[comp_idx[root]].size();
+		comps[comp_idx[root]].push_back(&graph.nodes[i]);
+	}
+
+	for(auto &edge : graph.edges)
+	{
+		comp_edges[comp_idx[find_root(edge.first)]].push_back(make_pair(local_idx[edge.first], local_idx[edge.second]));
+	}
+
+	//Arranging each connected component
+	for(i=0; i < comps.size(); i++)
+	{
+		if(comps[i].size()==1)
+			isolated.push_back(comps[i][0]);
+		else
+		{
+			arrangeComponent(comps[i], comp_edges[i], thread_cnt);
+			removeOverlapping(comps[i]);
+			blocks.push_back(comps[i]);
+		}
+	}
+
+	//Bigger components first
+	std::stable_sort(blocks.begin(), blocks.end(),
+									 [](const vector<LayoutNode *> &b1, const vector<LayoutNode *> &b2){ return(b1.size() > b2.size()); });
+
+	for(auto &block : blocks)
+		blocks_size.push_back(normalizeNodes(block));
+
+	//The tables without relationships are placed in a grid (tabs_per_row columns) after the components
+	if(!isolated.empty())
+	{
+		double max_y=0;
+		unsigned tab_id=0;
+
+		x=y=0;
+		for(auto &node : isolated)
+		{
+			node->pos=QPointF(x, y);
+			max_y=std::max(max_y, y + node->size.height());
+			tab_id++;
+
+			if(tab_id >= tabs_per_row)
+			{
+				tab_id=0;
+				y=max_y + obj_spacing;
+				x=0;
+			}
+			else
+				x+=node->size.width() + obj_spacing;
+		}
+
+		blocks.push_back(isolated);
+		blocks_size.push_back(normalizeNodes(isolated));
+	}
+
+	//Packing the blocks in shelves which width is proportional to the total area
+	for(auto &size : blocks_size)
+	{
+		total_area+=(size.width() + obj_spacing) * (size.height() + obj_spacing);
+		row_width=std::max<double>(row_width, size.width());
+	}
+
+	row_width=std::max(row_width, sqrt(total_area) * 1.3);
+	x=y=0;
+
+	for(i=0; i < blocks.size(); i++)
+	{
+		if(x > 0 && x + blocks_size[i].width() > row_width)
+		{
+			x=0;
+			y+=row_h + obj_spacing;
+			row_h=0;
+		}
+
+		for(auto &node : blocks[i])
+			node->pos+=QPointF(x, y);
+
+		max_x=std::max(max_x, x + blocks_size[i].width());
+		row_h=std::max<double>(row_h, blocks_size[i].height());
+		x+=blocks_size[i].width() + obj_spacing;
+	}
+
+	graph.size=QSizeF(max_x, y + row_h);
+}
+
+void GraphLayoutEngine::arrangeComponent(vector<LayoutNode *> &nodes, vector<pair<unsigned, unsigned>> &edges, unsigned thread_cnt)
+{
+	unsigned count=nodes.size(), i, it, start=0;
+	vector<vector<unsigned>> adjacency(count);
+	vector<unsigned> bfs_order;
+	vector<bool> visited(count, false);
+	vector<QuadCell> cells;
+	double k=0, temp, init_temp, dx, dy, dist, force, len;
+
+	//The ideal distance between nodes is based upon the average size of the tables
+	for(auto &node : nodes)
+		k+=hypot(node->size.width(), node->size.height());
+
+	k=(k/count) * 0.6 + obj_spacing;
+
+	for(auto &edge : edges)
+	{
+		adjacency[edge.first].push_back(edge.second);
+		adjacency[edge.second].push_back(edge.first);
+	}
+
+	for(i=1; i < count; i++)
+	{
+		if(adjacency[i].size() > adjacency[start].size())
+			start=i;
+	}
+
+	/* Initial positions in a spiral following a BFS from the most connected node,
+	this way the result is deterministic and neighbours start near each other */
+	bfs_order.push_back(start);
+	visited[start]=true;
+
+	for(i=0; i < bfs_order.size(); i++)
+	{
+		for(auto &adj : adjacency[bfs_order[i]])
+		{
+			if(!visited[adj])
+			{
+				visited[adj]=true;
+				bfs_order.push_back(adj);
+			}
+		}
+	}
+
+	for(i=0; i < bfs_order.size(); i++)
+	{
+		dist=k * 0.5 * sqrt(static_cast<double>(i));
+		nodes[bfs_order[i]]->pos=QPointF(dist * cos(i * 2.39996323), dist * sin(i * 2.39996323));
+	}
+
+	//Fruchterman-Reingold simulation with linear cooling
+	init_temp=temp=std::max(k, k * sqrt(static_cast<double>(count)) / 5.0);
+
+	for(it=0; it < LAYOUT_ITERATIONS; it++)
+	{
+		buildQuadtree(nodes, cells);
+
+		if(thread_cnt > 1 && count >= PARALLEL_THRESHOLD)
+		{
+			vector<std::thread> threads;
+			unsigned chunk=(count / thread_cnt) + 1, end;
+
+			for(i=0; i < count; i+=chunk)
+			{
+				end=std::min(count, i + chunk);
+				threads.push_back(std::thread(&GraphLayoutEngine::calculateRepulsion, this,
+																			std::ref(nodes), std::ref(cells), k, i, end));
+			}
+
+			for(auto &thread : threads)
+				thread.join();
+		}
+		else
+			calculateRepulsion(nodes, cells, k, 0, count);
+
+		for(auto &edge : edges)
+		{
+			LayoutNode *n1=nodes[edge.first], *n2=nodes[edge.second];
+
+			dx=n1->pos.x() - n2->pos.x();
+			dy=n1->pos.y() - n2->pos.y();
+			dist=std::max(0.01, hypot(dx, dy));
+			force=dist / k;
+
+			n1->disp-=QPointF(dx * force, dy * force);
+			n2->disp+=QPointF(dx * force, dy * force);
+		}
+
+		for(auto &node : nodes)
+		{
+			//The gravity pulls the nodes to the center avoiding components too sparse
+			node->disp-=node->pos * GRAVITY;
+			len=hypot(node->disp.x(), node->disp.y());
+
+			if(len > 0)
+				node->pos+=node->disp * (std::min(len, temp) / len);
+		}
+
+		temp=std::max(k * 0.01, init_temp * (1.0 - (it + 1) / static_cast<double>(LAYOUT_ITERATIONS)));
+	}
+
+	//The simulation works with the center of the tables, converting it to the top-left point
+	for(auto &node : nodes)
+		node->pos-=QPointF(node->size.width()/2.0, node->size.height()/2.0);
+}
+
+void GraphLayoutEngine::buildQuadtree(vector<LayoutNode *> &nodes, vector<QuadCell> &cells)
+{
+	double min_x, min_y, max_x, max_y;
+	QuadCell root;
+
+	cells.clear();
+	min_x=max_x=nodes[0]->pos.x();
+	min_y=max_y=nodes[0]->pos.y();
+
+	for(auto &node : nodes)
+	{
+		min_x=std::min(min_x, node->pos.x());
+		min_y=std::min(min_y, node->pos.y());
+		max_x=std::max(max_x, node->pos.x());
+		max_y=std::max(max_y, node->pos.y());
+	}
+
+	root.cx=(min_x + max_x)/2.0;
+	root.cy=(min_y + max_y)/2.0;
+	root.half=(std::max(max_x - min_x, max_y - min_y)/2.0) + 1;
+	root.mx=root.my=root.mass=0;
+	root.node=-1;
+	root.children[0]=root.children[1]=root.children[2]=root.children[3]=-1;
+
+	cells.reserve(nodes.size() * 2);
+	cells.push_back(root);
+
+	for(unsigned i=0; i < nodes.size(); i++)
+		insertQuadtreeNode(cells, nodes, 0, i, 0);
+}
+
+void GraphLayoutEngine::insertQuadtreeNode(vector<QuadCell> &cells, vector<LayoutNode *> &nodes, int cell_idx, int node_idx, unsigned depth)
+{
+	QPointF pos=nodes[node_idx]->pos;
+	vector<int> to_place;
+	int quad, child;
+
+	//Empty cell: the node is stored as leaf
+	if(cells[cell_idx].mass==0)
+	{
+		cells[cell_idx].node=node_idx;
+		cells[cell_idx].mass=1;
+		cells[cell_idx].mx=pos.x();
+		cells[cell_idx].my=pos.y();
+		return;
+	}
+
+	//The node which was stored as leaf is moved down to a child cell
+	if(cells[cell_idx].node >= 0 && depth < BH_MAX_DEPTH)
+	{
+		to_place.push_back(cells[cell_idx].node);
+		cells[cell_idx].node=-1;
+	}
+
+	//Updating the center of mass
+	cells[cell_idx].mx=((cells[cell_idx].mx * cells[cell_idx].mass) + pos.x())/(cells[cell_idx].mass + 1);
+	cells[cell_idx].my=((cells[cell_idx].my * cells[cell_idx].mass) + pos.y())/(cells[cell_idx].mass + 1);
+	cells[cell_idx].mass+=1;
+
+	//At maximum depth the nodes are only aggregated in the cell
+	if(depth >= BH_MAX_DEPTH)
+	{
+		cells[cell_idx].node=-1;
+		return;
+	}
+
+	to_place.push_back(node_idx);
+
+	for(auto &idx : to_place)
+	{
+		pos=nodes[idx]->pos;
+		quad=(pos.x() >= cells[cell_idx].cx ? 1 : 0) + (pos.y() >= cells[cell_idx].cy ? 2 : 0);
+		child=cells[cell_idx].children[quad];
+
+		if(child < 0)
+		{
+			QuadCell cell;
+			double half=cells[cell_idx].half/2.0;
+
+			cell.cx=cells[cell_idx].cx + ((quad & 1) ? half : -half);
+			cell.cy=cells[cell_idx].cy + ((quad & 2) ? half : -half);
+			cell.half=half;
+			cell.mx=cell.my=cell.mass=0;
+			cell.node=-1;
+			cell.children[0]=cell.children[1]=cell.children[2]=cell.children[3]=-1;
+
+			//The push_back may reallocate the vector so the index is stored only after it
+			child=cells.size();
+			cells.push_back(cell);
+			cells[cell_idx].children[quad]=child;
+		}
+
+		insertQuadtreeNode(cells, nodes, child, idx, depth + 1);
+	}
+}
+
+void GraphLayoutEngine::calculateRepulsion(vector<LayoutNode *> &nodes, vector<QuadCell> &cells, double k, unsigned start, unsigned end)
+{
+	vector<int> stack;
+	double k2=k * k, theta2=BH_THETA * BH_THETA, dx, dy, dist2, force, fx, fy;
+	bool is_leaf;
+
+	for(unsigned i=start; i < end; i++)
+	{
+		fx=fy=0;
+		stack.clear();
+		stack.push_back(0);
+
+		while(!stack.empty())
+		{
+			QuadCell &cell=cells[stack.back()];
+			stack.pop_back();
+
+			if(cell.mass==0 || cell.node==static_cast<int>(i))
+				continue;
+
+			dx=nodes[i]->pos.x() - cell.mx;
+			dy=nodes[i]->pos.y() - cell.my;
+			dist2=(dx * dx) + (dy * dy);
+			is_leaf=(cell.children[0] < 0 && cell.children[1] < 0 &&
+							 cell.children[2] < 0 && cell.children[3] < 0);
+
+			//Far enough cells (or leaves) are treated as a single body placed at their center of mass
+			if(is_leaf || (4.0 * cell.half * cell.half) < (theta2 * dist2))
+			{
+				//Coincident nodes are pushed apart in a deterministic direction
+				if(dist2 < 0.01)
+				{
+					dx=((i % 2) ? 0.1 : -0.1);
+					dy=(((i / 2) % 2) ? 0.1 : -0.1);
+					dist2=0.02;
+				}
+
+				force=(k2 * cell.mass)/dist2;
+				fx+=dx * force;
+				fy+=dy * force;
+			}
+			else
+			{
+				for(int c=0; c < 4; c++)
+				{
+					if(cell.children[c] >= 0)
+						stack.push_back(cell.children[c]);
+				}
+			}
+		}
+
+		nodes[i]->disp=QPointF(fx, fy);
+	}
+}
+
+void GraphLayoutEngine::removeOverlapping(vector<LayoutNode *> &nodes)
+{
+	vector<LayoutNode *> sorted=nodes;
+	double ovr_x, ovr_y, shift;
+	bool moved=true;
+
+	for(unsigned pass=0; pass < OVERLAP_PASSES && moved; pass++)
+	{
+		moved=false;
+
+		//Sweeping over the nodes sorted by x, only the nodes horizontally near each other are compared
+		std::sort(sorted.begin(), sorted.end(),
+							[](LayoutNode *n1, LayoutNode *n2){ return(n1->pos.x() < n2->pos.x()); });
+
+		for(unsigned a=0; a < sorted.size(); a++)
+		{
+			LayoutNode *n1=sorted[a];
+
+			for(unsigned b=a + 1; b < sorted.size(); b++)
+			{
+				LayoutNode *n2=sorted[b];
+
+				if(n2->pos.x() >= n1->pos.x() + n1->size.width() + obj_spacing)
+					break;
+
+				ovr_x=std::min(n1->pos.x() + n1->size.width(), n2->pos.x() + n2->size.width()) + obj_spacing - std::max(n1->pos.x(), n2->pos.x());
+				ovr_y=std::min(n1->pos.y() + n1->size.height(), n2->pos.y() + n2->size.height()) + obj_spacing - std::max(n1->pos.y(), n2->pos.y());
+
+				if(ovr_x <= 0 || ovr_y <= 0)
+					continue;
+
+				//The nodes are moved along the axis with the smaller overlapping
+				if(ovr_x < ovr_y)
+				{
+					shift=ovr_x/2.0;
+
+					if(n1->pos.x() + n1->size.width()/2.0 <= n2->pos.x() + n2->size.width()/2.0)
+						shift=-shift;
+
+					n1->pos.rx()+=shift;
+					n2->pos.rx()-=shift;
+				}
+				else
+				{
+					shift=ovr_y/2.0;
+
+					if(n1->pos.y() + n1->size.height()/2.0 <= n2->pos.y() + n2->size.height()/2.0)
+						shift=-shift;
+
+					n1->pos.ry()+=shift;
+					n2->pos.ry()-=shift;
+				}
+
+				moved=true;
+			}
+		}
+	}
+}
+
+QSizeF GraphLayoutEngine::normalizeNodes(vector<LayoutNode *> &nodes)
+{
+	double min_x, min_y, max_x, max_y;
+
+	if(nodes.empty())
+		return(QSizeF(0,0));
+
+	min_x=min_y=std::numeric_limits<double>::max();
+	max_x=max_y=std::numeric_limits<double>::lowest();
+
+	for(auto &node : nodes)
+	{
+		min_x=std::min(min_x, node->pos.x());
+		min_y=std::min(min_y, node->pos.y());
+		max_x=std::max(max_x, node->pos.x() + node->size.width());
+		max_y=std::max(max_y, node->pos.y() + node->size.height());
+	}
+
+	for(auto &node : nodes)
+		node->pos-=QPointF(min_x, min_y);
+
+	return(QSizeF(max_x - min_x, max_y - min_y));
+}
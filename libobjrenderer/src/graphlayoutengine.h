@@ -0,0 +1,137 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2015 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libobjrenderer
+\class GraphLayoutEngine
+\brief Implements an automatic layout for tables and views based upon the relationships graph.
+\note The tables of each schema are grouped by connected components and each component is
+arranged through a force-directed algorithm (Fruchterman-Reingold) in which the repulsion forces
+are approximated using a Barnes-Hut quadtree. The schemas are processed in parallel and, when only one
+schema is being arranged, the force calculation itself is split among the available threads.
+*/
+
+#ifndef GRAPH_LAYOUT_ENGINE_H
+#define GRAPH_LAYOUT_ENGINE_H
+
+#include <QPointF>
+#include <QSizeF>
+#include <vector>
+#include "databasemodel.h"
+#include "basetableview.h"
+
+class GraphLayoutEngine {
+	private:
+		//! \brief Stores the data of one table/view used during the layout (no graphical item is touched by worker threads)
+		struct LayoutNode {
+			BaseTableView *view;
+			QSizeF size;
+			QPointF pos, disp;
+		};
+
+		//! \brief Stores the graph of one schema and the resulting arrangement
+		struct SchemaGraph {
+			Schema *schema;
+			vector<LayoutNode> nodes;
+			vector<pair<unsigned, unsigned>> edges;
+			QSizeF size;
+		};
+
+		//! \brief Stores a cell of the Barnes-Hut quadtree
+		struct QuadCell {
+			//! \brief Center and half of the side of the (square) cell
+			double cx, cy, half;
+
+			//! \brief Center of mass and mass (amount of nodes) of the cell
+			double mx, my, mass;
+
+			//! \brief Indexes of the children cells (-1 when not created)
+			int children[4];
+
+			//! \brief Index of the node stored in a leaf cell (-1 when the cell is internal or empty)
+			int node;
+		};
+
+		//! \brief Barnes-Hut approximation criterion (cell size / distance)
+		static constexpr double BH_THETA=0.9,
+
+		//! \brief Factor of the force that attracts the nodes to the center of the component
+		GRAVITY=1.0;
+
+		//! \brief Maximum depth of the quadtree (avoids infinite subdivision for coincident nodes)
+		static const unsigned BH_MAX_DEPTH=24,
+
+		//! \brief Amount of iterations of the force-directed simulation
+		LAYOUT_ITERATIONS=250,
+
+		//! \brief Amount of passes used to remove the overlapping between tables
+		OVERLAP_PASSES=40,
+
+		//! \brief Minimum amount of nodes in a component to split the force calculation among threads
+		PARALLEL_THRESHOLD=300;
+
+		//! \brief Spacing between objects
+		float obj_spacing;
+
+		//! \brief Amount of isolated tables (without relationships) placed per row
+		unsigned tabs_per_row,
+
+		//! \brief Amount of schemas placed per row
+		sch_per_row;
+
+		//! \brief Builds the graph of each schema that owns tables or views
+		vector<SchemaGraph> buildGraphs(DatabaseModel *model);
+
+		/*! \brief Returns the schemas indexes sorted so the schemas with more relationships among them
+		are placed near each other */
+		vector<unsigned> sortSchemas(DatabaseModel *model, vector<SchemaGraph> &graphs);
+
+		//! \brief Arranges the nodes of the schema graph (relative to origin 0,0) using the specified amount of threads
+		void arrangeGraph(SchemaGraph &graph, unsigned thread_cnt);
+
+		//! \brief Runs the force-directed simulation over the nodes of a connected component
+		void arrangeComponent(vector<LayoutNode *> &nodes, vector<pair<unsigned, unsigned>> &edges, unsigned thread_cnt);
+
+		//! \brief Builds the quadtree for the nodes returning the cells (the first one is the root)
+		void buildQuadtree(vector<LayoutNode *> &nodes, vector<QuadCell> &cells);
+
+		//! \brief Inserts the node on the quadtree starting from the specified cell
+		void insertQuadtreeNode(vector<QuadCell> &cells, vector<LayoutNode *> &nodes, int cell_idx, int node_idx, unsigned depth);
+
+		//! \brief Calculates the repulsion displacement for the nodes in the range [start, end[
+		void calculateRepulsion(vector<LayoutNode *> &nodes, vector<QuadCell> &cells, double k, unsigned start, unsigned end);
+
+		//! \brief Moves the nodes apart in order to avoid overlapping boxes
+		void removeOverlapping(vector<LayoutNode *> &nodes);
+
+		//! \brief Translates the nodes so the top-left corner of the group is at 0,0 and returns the group size
+		QSizeF normalizeNodes(vector<LayoutNode *> &nodes);
+
+	public:
+		GraphLayoutEngine(void);
+
+		void setObjectSpacing(float spacing);
+		void setTablesPerRow(unsigned count);
+		void setSchemasPerRow(unsigned count);
+
+		/*! \brief Rearranges all tables and views of the model starting at the specified origin.
+		The objects must have their graphical representation created (BaseTableView) otherwise they are ignored */
+		void rearrangeObjects(DatabaseModel *model, const QPointF &origin);
+};
+
+#endif
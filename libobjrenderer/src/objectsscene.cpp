@@ -52,12 +52,17 @@ ObjectsScene::ObjectsScene(void)
 	this->addItem(rel_line);
 
   scene_move_dx=scene_move_dy=0;
+  bulk_insertion=false;
 
   connect(&scene_move_timer, SIGNAL(timeout()), this, SLOT(moveObjectScene()));
   connect(&corner_hover_timer, SIGNAL(timeout()), this, SLOT(enableSceneMove()));
 
   scene_move_timer.setInterval(SCENE_MOVE_TIMEOUT);
   corner_hover_timer.setInterval(SCENE_MOVE_TIMEOUT * 10);
+
+  rels_config_timer.setSingleShot(true);
+  rels_config_timer.setInterval(RELS_CONFIG_TIMEOUT);
+  connect(&rels_config_timer, SIGNAL(timeout()), this, SLOT(configureMovedTablesRelationships()));
 }
 
 ObjectsScene::~ObjectsScene(void)
@@ -142,6 +147,9 @@ void ObjectsScene::setSceneRect(const QRectF &rect)
 
 QRectF ObjectsScene::itemsBoundingRect(bool seek_only_db_objs)
 {
+  //Pending relationship reconfigurations are applied so their geometry is considered correctly
+  configureMovedTablesRelationships();
+
   if(!seek_only_db_objs)
     return(QGraphicsScene::itemsBoundingRect());
   else
@@ -400,11 +408,18 @@ void ObjectsScene::addItem(QGraphicsItem *item)
 		BaseObjectView *obj=dynamic_cast<BaseObjectView *>(item);
 
 		if(rel)
+		{
 			connect(rel, SIGNAL(s_relationshipModified(BaseGraphicObject*)),
 							this, SLOT(emitObjectModification(BaseGraphicObject*)));
+			registerRelationship(rel);
+		}
 		else if(tab)
+		{
 			connect(tab, SIGNAL(s_childObjectSelected(TableObject*)),
 							this, SLOT(emitChildObjectSelection(TableObject*)));
+			connect(tab, SIGNAL(s_objectMoved(void)), this, SLOT(registerMovedTable(void)));
+			connect(tab, SIGNAL(s_objectDimensionChanged(void)), this, SLOT(registerMovedTable(void)));
+		}
 
 		if(obj)
 		{
@@ -422,9 +437,21 @@ void ObjectsScene::removeItem(QGraphicsItem *item)
 	{
     BaseObjectView *object=dynamic_cast<BaseObjectView *>(item);
 		RelationshipView *rel=dynamic_cast<RelationshipView *>(item);
+		BaseTableView *tab=dynamic_cast<BaseTableView *>(item);
 
     if(rel)
+    {
+      unregisterRelationship(rel);
       rel->disconnectTables();
+      pending_rels.erase(rel);
+    }
+    else if(tab)
+    {
+      tables_rels.erase(tab);
+      moved_tables.erase(tab);
+    }
+    else if(dynamic_cast<SchemaView *>(item))
+      pending_schemas.erase(dynamic_cast<SchemaView *>(item));
 
 		item->setVisible(false);
 		item->setActive(false);
@@ -737,6 +764,9 @@ void ObjectsScene::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
     dx=event->scenePos().x() - sel_ini_pnt.x();
     dy=event->scenePos().y() - sel_ini_pnt.y();
 
+    //Applies the pending relationship reconfigurations so their bounding rects reflect the last movement
+    configureMovedTablesRelationships();
+
     count=items.size();
     for(i=0; i < count; i++)
     {
@@ -797,6 +827,9 @@ void ObjectsScene::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
     //Reconfigures the rectangle with the most extreme points
     rect.setCoords(x1, y1, x2, y2);
 
+    //The relationships connected to the moved tables must be up to date before resizing the scene
+    configureMovedTablesRelationships();
+
     //If the new rect is greater than the scene bounding rect, this latter is resized
     if(rect!=this->sceneRect())
     {
@@ -883,6 +916,136 @@ void ObjectsScene::alignObjectsToGrid(void)
 		schemas.back()->setModified(true);
 		schemas.pop_back();
 	}
+
+	configureMovedTablesRelationships();
+}
+
+void ObjectsScene::registerRelationship(RelationshipView *rel)
+{
+	BaseTableView *tab=nullptr;
+	vector<RelationshipView *> *rels=nullptr;
+
+	for(unsigned i=BaseRelationship::SRC_TABLE; i <= BaseRelationship::DST_TABLE; i++)
+	{
+		tab=rel->getConnectedTable(i);
+
+		if(tab)
+		{
+			rels=&tables_rels[tab];
+
+			//Avoids registering twice self relationships
+			if(std::find(rels->begin(), rels->end(), rel)==rels->end())
+				rels->push_back(rel);
+		}
+	}
+}
+
+void ObjectsScene::unregisterRelationship(RelationshipView *rel)
+{
+	BaseTableView *tab=nullptr;
+	vector<RelationshipView *>::iterator itr;
+
+	for(unsigned i=BaseRelationship::SRC_TABLE; i <= BaseRelationship::DST_TABLE; i++)
+	{
+		tab=rel->getConnectedTable(i);
+
+		if(tab && tables_rels.count(tab))
+		{
+			vector<RelationshipView *> &rels=tables_rels[tab];
+
+			itr=std::find(rels.begin(), rels.end(), rel);
+			if(itr!=rels.end())
+				rels.erase(itr);
+		}
+	}
+}
+
+void ObjectsScene::registerMovedTable(void)
+{
+	BaseTableView *tab=dynamic_cast<BaseTableView *>(sender());
+
+	if(tab && tables_rels.count(tab) && !tables_rels[tab].empty())
+	{
+		moved_tables.insert(tab);
+
+		/* The timer is not restarted when active so, while the user drags the tables,
+		the relationships are reconfigured at most once per timeout */
+		if(!rels_config_timer.isActive())
+			rels_config_timer.start();
+	}
+}
+
+void ObjectsScene::configureMovedTablesRelationships(void)
+{
+	set<RelationshipView *> rels;
+
+	rels_config_timer.stop();
+
+	//Gathering the relationships once, so the ones linking two moved tables are configured a single time
+	for(auto &tab : moved_tables)
+	{
+		if(tables_rels.count(tab))
+			rels.insert(tables_rels[tab].begin(), tables_rels[tab].end());
+	}
+
+	moved_tables.clear();
+
+	for(auto &rel : rels)
+		rel->configureLine();
+}
+
+void ObjectsScene::startBulkInsertion(void)
+{
+	bulk_insertion=true;
+
+	//Updating the BSP tree at each insertion is expensive so the index is rebuilt only once at the end
+	this->setItemIndexMethod(QGraphicsScene::NoIndex);
+}
+
+void ObjectsScene::finishBulkInsertion(void)
+{
+	if(bulk_insertion)
+	{
+		bulk_insertion=false;
+		rels_config_timer.stop();
+
+		//The relationships connected to moved tables are configured together with the deferred ones
+		for(auto &tab : moved_tables)
+		{
+			if(tables_rels.count(tab))
+				pending_rels.insert(tables_rels[tab].begin(), tables_rels[tab].end());
+		}
+
+		moved_tables.clear();
+
+		//Relationships are configured first since the tables' geometry is final at this point
+		for(auto &rel : pending_rels)
+			rel->configureLine();
+
+		for(auto &schema : pending_schemas)
+			schema->configureObject();
+
+		pending_rels.clear();
+		pending_schemas.clear();
+		this->setItemIndexMethod(QGraphicsScene::BspTreeIndex);
+	}
+}
+
+bool ObjectsScene::isBulkInsertion(void)
+{
+	return(bulk_insertion);
+}
+
+void ObjectsScene::deferConfiguration(SchemaView *schema)
+{
+	if(schema)
+		pending_schemas.insert(schema);
+}
+
+void ObjectsScene::deferConfiguration(RelationshipView *rel)
+{
+	if(rel)
+		pending_rels.insert(rel);
 }
 
 void ObjectsScene::update(void)
@@ -899,6 +1062,8 @@ vector<QRectF> ObjectsScene::getPagesForPrinting(const QSizeF &paper_size, const
   unsigned h_page=0, v_page=0, start_h=99999, start_v=99999;
   QList<QGraphicsItem *> list;
 
+  configureMovedTablesRelationships();
+
   page_width=ceilf(paper_size.width() - margin.width()-1);
   page_height=ceilf(paper_size.height() - margin.height()-1);
 
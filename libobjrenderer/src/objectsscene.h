@@ -27,6 +27,7 @@
 
 #include <QtWidgets>
 #include <QPrinter>
+#include <set>
 #include "relationshipview.h"
 #include "graphicalview.h"
 #include "tableview.h"
@@ -51,7 +52,26 @@ class ObjectsScene: public QGraphicsScene {
 
     static const int SCENE_MOVE_STEP=20,
                      SCENE_MOVE_TIMEOUT=50,
-                     SCENE_MOVE_THRESHOLD=30;
+                     SCENE_MOVE_THRESHOLD=30,
+
+                     //! brief Interval (in ms) in which the moved tables are accumulated before reconfiguring their relationships (~ one frame)
+                     RELS_CONFIG_TIMEOUT=16;
+
+    //! \brief Stores the relationships connected to each table in the scene (table -> relationships adjacency)
+    map<BaseTableView *, vector<RelationshipView *>> tables_rels;
+
+    //! \brief Stores the tables moved or resized since the last relationship reconfiguration
+    set<BaseTableView *> moved_tables;
+
+    //! \brief Timer used to batch the relationship reconfiguration of moved tables
+    QTimer rels_config_timer;
+
+    //! \brief Indicates that the scene is in bulk insertion mode (see startBulkInsertion())
+    bool bulk_insertion;
+
+    //! \brief Schemas and relationships whose geometry configuration was deferred during the bulk insertion
+    set<SchemaView *> pending_schemas;
+    set<RelationshipView *> pending_rels;
 
     //! \brief Timer responsible to move the scene
     QTimer scene_move_timer,
@@ -105,6 +125,12 @@ class ObjectsScene: public QGraphicsScene {
 
     QGraphicsView *getActiveViewport(void);
 
+    //! \brief Registers the relationship on the table -> relationships adjacency map
+    void registerRelationship(RelationshipView *rel);
+
+    //! \brief Removes the relationship from the table -> relationships adjacency map
+    void unregisterRelationship(RelationshipView *rel);
+
 	protected:
 		//! \brief Brush used to draw the grid over the scene
 		static QBrush grid;
@@ -152,15 +178,37 @@ class ObjectsScene: public QGraphicsScene {
     bool isPanningRangeSelectionInverted(void);
 		bool isRelationshipLineVisible(void);
 
+		/*! \brief Starts the bulk insertion mode used when a large amount of objects is added at once (model loading or importing).
+		While in this mode the items index is disabled and the geometry of the schemas and relationships is
+		not configured, they are only registered (see deferConfiguration()) to be configured once in finishBulkInsertion() */
+		void startBulkInsertion(void);
+
+		//! \brief Finishes the bulk insertion configuring the deferred relationships and schemas and restoring the items index
+		void finishBulkInsertion(void);
+
+		bool isBulkInsertion(void);
+
+		//! \brief Registers the schema or relationship to have its geometry configured when the bulk insertion finishes
+		void deferConfiguration(SchemaView *schema);
+		void deferConfiguration(RelationshipView *rel);
+
 	public slots:
 		void alignObjectsToGrid(void);
 
+		/*! \brief Reconfigures (once) the lines of all relationships connected to the tables moved or resized
+		since the last call. This method is called automatically by a timer but can be called directly
+		when the relationships' geometry must be up to date immediately */
+		void configureMovedTablesRelationships(void);
+
 		void update(void);
 
     //! brief Toggles the object range selection
     void enableRangeSelection(bool value);
 
 	private slots:
+    //! \brief Registers the table that emitted the signal as moved and schedules the reconfiguration of its relationships
+    void registerMovedTable(void);
+
     /*! brief Start/stop the timer responsible to move the scene. This method is called with true param
     whenever the user stay with the cursor at corner in a certain amount of time */
     void enableSceneMove(bool value=true);
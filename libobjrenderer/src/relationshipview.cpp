@@ -17,6 +17,7 @@
 */
 
 #include "relationshipview.h"
+#include "objectsscene.h"
 
 bool RelationshipView::hide_name_label=false;
 unsigned RelationshipView::line_conn_mode=RelationshipView::CONNECT_FK_TO_PK;
@@ -403,6 +404,14 @@ void RelationshipView::disconnectTables(void)
 	}
 }
 
+BaseTableView *RelationshipView::getConnectedTable(unsigned table_idx)
+{
+	if(table_idx > BaseRelationship::DST_TABLE)
+		throw Exception(ERR_REF_ELEM_INV_INDEX, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	return(tables[table_idx]);
+}
+
 void RelationshipView::configureObject(void)
 {
 	BaseRelationship *rel_base=this->getSourceObject();
@@ -415,14 +424,10 @@ void RelationshipView::configureObject(void)
 	if(!rel_base->isSelfRelationship())
 		tables[1]->updateConnectedRelsCount(1);
 
+	/* The line reconfiguration due to the tables' movement or resizing is done by the
+	scene (see ObjectsScene::configureMovedTablesRelationships) so it can be batched */
 	this->configureLine();
 
-	for(unsigned i=0; i < 2; i++)
-	{
-		connect(tables[i], SIGNAL(s_objectMoved(void)), this, SLOT(configureLine(void)));
-		connect(tables[i], SIGNAL(s_objectDimensionChanged(void)), this, SLOT(configureLine(void)));
-	}
-
 	connect(rel_base, SIGNAL(s_objectModified()), this, SLOT(configureLine(void)));
 }
 
@@ -440,7 +445,15 @@ void RelationshipView::configurePositionInfo(void)
 
 void RelationshipView::configureLine(void)
 {
-	if(!configuring_line)
+	/* When the relationship is not yet on a scene (e.g. called from the constructor) the scene
+	of the source table is used to check if a bulk insertion is running */
+	ObjectsScene *obj_scene=dynamic_cast<ObjectsScene *>(this->scene() ? this->scene() :
+																											 (tables[0] ? tables[0]->scene() : nullptr));
+
+	//During a bulk insertion the line is configured only once, when the tables' geometry is final
+	if(obj_scene && obj_scene->isBulkInsertion())
+		obj_scene->deferConfiguration(this);
+	else if(!configuring_line)
 	{
 		BaseRelationship *base_rel=this->getSourceObject();
 		Relationship *rel=dynamic_cast<Relationship *>(base_rel);
@@ -140,6 +140,9 @@ class RelationshipView: public BaseObjectView {
 		//! \brief Disconnects the signal handled by the relationship which senders are the tables
 		void disconnectTables(void);
 
+		//! \brief Returns the graphical representation of the table connected to the relationship (BaseRelationship::SRC_TABLE | DST_TABLE)
+		BaseTableView *getConnectedTable(unsigned table_idx);
+
 		//! \brief Hides the relationship's name label. This applies to all relationship instances
 		static void setHideNameLabel(bool value);
 
@@ -17,6 +17,7 @@
 */
 
 #include "schemaview.h"
+#include "objectsscene.h"
 
 SchemaView::SchemaView(Schema *schema) : BaseObjectView(schema)
 {
@@ -149,6 +150,14 @@ QList<BaseObjectView *> SchemaView::getChildren(void)
 void SchemaView::configureObject(void)
 {
 	Schema *schema=dynamic_cast<Schema *>(this->getSourceObject());
+	ObjectsScene *obj_scene=dynamic_cast<ObjectsScene *>(this->scene());
+
+	//During a bulk insertion the schema is configured only once, when all its children are on the scene
+	if(obj_scene && obj_scene->isBulkInsertion())
+	{
+		obj_scene->deferConfiguration(this);
+		return;
+	}
 
 	this->fetchChildren();
 
@@ -61,10 +61,15 @@ const QString SchemaParser::TOKEN_LT_EQ_OP=QString("<=");
 
 const QRegExp SchemaParser::ATTR_REGEXP=QRegExp("^([a-z])([a-z]*|(\\d)*|(\\-)*|(_)*)+", Qt::CaseInsensitive);
 
+map<QString, SchemaParser::SchemaFile> SchemaParser::loaded_files;
+QMutex SchemaParser::loaded_files_mutex;
+
 SchemaParser::SchemaParser(void)
 {
 	line=column=comment_count=0;
+	ext_attribs=nullptr;
   ignore_unk_atribs=ignore_empty_atribs=false;
+	xml_definition=in_xml_value=false;
   pgsql_version=PgSQLVersions::DEFAULT_VERSION;
 }
 
@@ -125,6 +130,8 @@ void SchemaParser::restartParser(void)
 		column and amount of comments */
 	buffer.clear();
 	attributes.clear();
+	attrib_tokens.reset();
+	ext_attribs=nullptr;
 	line=column=comment_count=0;
 }
 
@@ -177,6 +184,20 @@ void SchemaParser::loadFile(const QString &filename)
 	{
 		QFile input;
 		QString buf;
+		QDateTime last_modified=QFileInfo(filename).lastModified();
+		QMutexLocker locker(&loaded_files_mutex);
+		map<QString, SchemaFile>::iterator itr=loaded_files.find(filename);
+
+		//Reuses the buffer prepared in a previous loading if the file wasn't changed since then
+		if(itr!=loaded_files.end() && itr->second.last_modified==last_modified)
+		{
+			restartParser();
+			buffer=itr->second.buffer;
+			comment_count=itr->second.comment_count;
+			attrib_tokens=itr->second.attrib_tokens;
+			SchemaParser::filename=filename;
+			return;
+		}
 
 		//Open the file for reading
 		input.setFileName(filename);
@@ -192,14 +213,90 @@ void SchemaParser::loadFile(const QString &filename)
 		//Loads the parser buffer
 		loadBuffer(buf);
 		SchemaParser::filename=filename;
+		attrib_tokens=resolveAttributes(buffer);
+
+		loaded_files[filename].last_modified=last_modified;
+		loaded_files[filename].buffer=buffer;
+		loaded_files[filename].comment_count=comment_count;
+		loaded_files[filename].attrib_tokens=attrib_tokens;
 	}
 }
 
+shared_ptr<vector<SchemaParser::AttribTokens>> SchemaParser::resolveAttributes(const QStringList &buffer)
+{
+	shared_ptr<vector<AttribTokens>> tokens=make_shared<vector<AttribTokens>>(buffer.size());
+	int start=0, end=0, ln=0;
+	QString attrib;
+
+	for(const QString &lin : buffer)
+	{
+		start=lin.indexOf(CHR_INI_ATTRIB);
+
+		while(start >= 0)
+		{
+			//Finds the end of the attribute name in the same way getAttribute() does
+			end=start + 1;
+			while(end < lin.size() && lin[end]!=CHR_END_ATTRIB && lin[end]!=CHR_INI_ATTRIB &&
+						lin[end]!=CHR_LINE_END && lin[end]!=CHR_SPACE && lin[end]!=CHR_TABULATION)
+				end++;
+
+			if(end < lin.size() && lin[end]==CHR_END_ATTRIB)
+			{
+				attrib=lin.mid(start + 1, end - start - 1);
+
+				if(!attrib.isEmpty() && ATTR_REGEXP.exactMatch(attrib))
+					(*tokens)[ln][start]=make_pair(attrib, end + 1);
+			}
+
+			start=lin.indexOf(CHR_INI_ATTRIB, start + 1);
+		}
+
+		ln++;
+	}
+
+	return(tokens);
+}
+
+bool SchemaParser::hasAttribute(const QString &attrib)
+{
+	return(attributes.count(attrib)!=0 || (ext_attribs && ext_attribs->count(attrib)!=0));
+}
+
+QString SchemaParser::getAttributeValue(const QString &attrib)
+{
+	attribs_map::iterator itr=attributes.find(attrib);
+
+	if(itr!=attributes.end())
+		return(itr->second);
+
+	if(ext_attribs)
+	{
+		itr=ext_attribs->find(attrib);
+
+		if(itr!=ext_attribs->end())
+			return(itr->second);
+	}
+
+	return(QString());
+}
+
 QString SchemaParser::getAttribute(void)
 {
   QString atrib, current_line;
 	bool start_attrib, end_attrib, error=false; 
 
+	//Uses the attribute resolved when the file was loaded avoiding to extract its name again
+	if(attrib_tokens && line < static_cast<int>(attrib_tokens->size()))
+	{
+		AttribTokens::iterator itr=(*attrib_tokens)[line].find(column);
+
+		if(itr!=(*attrib_tokens)[line].end())
+		{
+			column=itr->second.second;
+			return(itr->second.first);
+		}
+	}
+
 	//Get the current line from the buffer
 	current_line=buffer[line];
 
@@ -485,7 +582,7 @@ bool SchemaParser::evaluateComparisonExpr(void)
                             .arg(oper).arg(filename).arg((line + comment_count + 1)).arg((column+1)),
                             ERR_INV_OPERATOR_IN_EXPR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
           }
-          else if(attributes.count(attrib)==0 && !ignore_unk_atribs)
+          else if(!hasAttribute(attrib) && !ignore_unk_atribs)
           {
             throw Exception(Exception::getErrorMessage(ERR_UNK_ATTRIBUTE)
                             .arg(attrib).arg(filename).arg((line + comment_count +1)).arg((column+1)),
@@ -493,15 +590,17 @@ bool SchemaParser::evaluateComparisonExpr(void)
           }
           else
           {
+            QString attr_value=getAttributeValue(attrib);
+
             value.remove(CHR_VAL_DELIM);
 
             //Evaluating the attribute value against the one captured on the expression
-            expr_is_true=((oper==TOKEN_EQ_OP && (attributes[attrib] == value)) ||
-                          (oper==TOKEN_NE_OP && (attributes[attrib] != value)) ||
-                          (oper==TOKEN_GT_OP && (attributes[attrib] > value)) ||
-                          (oper==TOKEN_LT_OP && (attributes[attrib] < value)) ||
-                          (oper==TOKEN_GT_EQ_OP && (attributes[attrib] >= value)) ||
-                          (oper==TOKEN_LT_EQ_OP && (attributes[attrib] <= value)));
+            expr_is_true=((oper==TOKEN_EQ_OP && (attr_value == value)) ||
+                          (oper==TOKEN_NE_OP && (attr_value != value)) ||
+                          (oper==TOKEN_GT_OP && (attr_value > value)) ||
+                          (oper==TOKEN_LT_OP && (attr_value < value)) ||
+                          (oper==TOKEN_GT_EQ_OP && (attr_value >= value)) ||
+                          (oper==TOKEN_LT_EQ_OP && (attr_value <= value)));
 
             end_eval=true;
           }
@@ -580,14 +679,14 @@ void SchemaParser::defineAttribute(void)
             //Get the attribute in the middle of the value
             attrib=getAttribute();
 
-            if(attributes.count(attrib)==0 && !ignore_unk_atribs)
+            if(!hasAttribute(attrib) && !ignore_unk_atribs)
             {
               throw Exception(Exception::getErrorMessage(ERR_UNK_ATTRIBUTE)
                               .arg(attrib).arg(filename).arg((line + comment_count +1)).arg((column+1)),
                               ERR_UNK_ATTRIBUTE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
             }
 
-            value+=attributes[attrib];
+            value+=getAttributeValue(attrib);
           }
         break;
 
@@ -616,7 +715,7 @@ void SchemaParser::defineAttribute(void)
 
   if(!error)
   {
-    attrib=(use_val_as_name ? attributes[new_attrib] : new_attrib);
+    attrib=(use_val_as_name ? getAttributeValue(new_attrib) : new_attrib);
 
     //Checking if the attribute has a valid name
     if(!ATTR_REGEXP.exactMatch(attrib))
@@ -659,7 +758,7 @@ void SchemaParser::unsetAttribute(void)
         case CHR_INI_ATTRIB:
           attrib=getAttribute();
 
-          if(attributes.count(attrib)==0 && !ignore_unk_atribs)
+          if(!hasAttribute(attrib) && !ignore_unk_atribs)
           {
             throw Exception(Exception::getErrorMessage(ERR_UNK_ATTRIBUTE)
                             .arg(attrib).arg(filename).arg((line + comment_count +1)).arg((column+1)),
@@ -753,7 +852,7 @@ bool SchemaParser::evaluateExpression(void)
 					attrib=getAttribute();
 
 					//Raises an error if the attribute does is unknown
-					if(attributes.count(attrib)==0 && !ignore_unk_atribs)
+					if(!hasAttribute(attrib) && !ignore_unk_atribs)
 					{
             throw Exception(Exception::getErrorMessage(ERR_UNK_ATTRIBUTE)
 														.arg(attrib).arg(filename).arg((line + comment_count +1)).arg((column+1)),
@@ -773,7 +872,7 @@ bool SchemaParser::evaluateExpression(void)
 					if(!error)
 					{
 						//Appliyng the NOT operator if found
-						attrib_true=(cond==TOKEN_NOT ? attributes[attrib].isEmpty() : !attributes[attrib].isEmpty());
+						attrib_true=(cond==TOKEN_NOT ? getAttributeValue(attrib).isEmpty() : !getAttributeValue(attrib).isEmpty());
 
 						//Executing the AND operation if the token is found
 						if(cond==TOKEN_AND || prev_cond==TOKEN_AND)
@@ -869,6 +968,7 @@ QString SchemaParser::getCodeDefinition(const QString & obj_name, attribs_map &a
 							 GlobalAttributes::SQL_SCHEMA_DIR + GlobalAttributes::DIR_SEPARATOR + obj_name + GlobalAttributes::SCHEMA_EXT;
 
       attribs[ParsersAttributes::PGSQL_VERSION]=pgsql_version;
+			xml_definition=false;
 
 			//Try to get the object definitin from the specified path
 			return(getCodeDefinition(filename, attribs));
@@ -879,11 +979,14 @@ QString SchemaParser::getCodeDefinition(const QString & obj_name, attribs_map &a
 							 GlobalAttributes::XML_SCHEMA_DIR + GlobalAttributes::DIR_SEPARATOR + obj_name +
 							 GlobalAttributes::SCHEMA_EXT;
 
-			return(convertCharsToXMLEntities(getCodeDefinition(filename, attribs)));
+			//The attributes values are converted to XML entities while the definition is generated
+			xml_definition=true;
+			return(getCodeDefinition(filename, attribs));
 		}
 	}
 	catch(Exception &e)
 	{
+		xml_definition=false;
 		throw Exception(e.getErrorMessage(),e.getErrorType(),	__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
 	}
 }
@@ -898,6 +1001,70 @@ void SchemaParser::ignoreEmptyAttributes(bool ignore)
   ignore_empty_atribs=ignore;
 }
 
+SchemaParserModeGuard::SchemaParserModeGuard(SchemaParser &parser, bool ignore_unk_atribs, bool ignore_empty_atribs) : parser(parser)
+{
+	this->ignore_unk_atribs=parser.isIgnoringUnkownAttributes();
+	this->ignore_empty_atribs=parser.isIgnoringEmptyAttributes();
+	parser.ignoreUnkownAttributes(ignore_unk_atribs);
+	parser.ignoreEmptyAttributes(ignore_empty_atribs);
+}
+
+SchemaParserModeGuard::~SchemaParserModeGuard(void)
+{
+	parser.ignoreUnkownAttributes(ignore_unk_atribs);
+	parser.ignoreEmptyAttributes(ignore_empty_atribs);
+}
+
+bool SchemaParser::isIgnoringUnkownAttributes(void)
+{
+	return(ignore_unk_atribs);
+}
+
+bool SchemaParser::isIgnoringEmptyAttributes(void)
+{
+	return(ignore_empty_atribs);
+}
+
+void SchemaParser::appendDefinition(QString &object_def, const QString &text, bool is_attrib_value)
+{
+	if(!xml_definition)
+		object_def+=text;
+	else if(is_attrib_value)
+		object_def+=(in_xml_value ? convertValueToXMLEntities(text) : text);
+	else
+	{
+		//An odd amount of quotes in the schema text opens or closes a tag attribute value
+		if(text.count(QChar('"')) % 2 != 0)
+			in_xml_value=!in_xml_value;
+
+		object_def+=text;
+	}
+}
+
+QString SchemaParser::convertValueToXMLEntities(const QString &value)
+{
+	QString str_aux;
+
+	//Avoiding the copy of values that don't need to be converted (the most common case)
+	if(!value.contains(QChar('"')) && !value.contains(QChar('<')) &&
+		 !value.contains(QChar('>')) && !value.contains(QChar('&')))
+		return(value);
+
+	str_aux=value;
+
+	//Ampersands are converted only when the value doesn't contain entities (already converted values)
+	if(!str_aux.contains(XMLParser::CHAR_QUOT) && !str_aux.contains(XMLParser::CHAR_LT) &&
+		 !str_aux.contains(XMLParser::CHAR_GT) &&  !str_aux.contains(XMLParser::CHAR_AMP) &&
+		 str_aux.contains('&'))
+		str_aux.replace('&',XMLParser::CHAR_AMP);
+
+	str_aux.replace('\"',XMLParser::CHAR_QUOT);
+	str_aux.replace('<',XMLParser::CHAR_LT);
+	str_aux.replace('>',XMLParser::CHAR_GT);
+
+	return(str_aux);
+}
+
 QString SchemaParser::convertCharsToXMLEntities(QString buf)
 {
 	//Configures a text stream to read the entire buffer line by line
@@ -1003,8 +1170,8 @@ QString SchemaParser::getCodeDefinition(attribs_map &attribs)
 	if(buffer.size() > 0)
   {
 		//Init the control variables
-		attributes=attribs;
-		error=if_expr=false;
+		ext_attribs=&attribs;
+		error=if_expr=in_xml_value=false;
 		if_level=-1;
 		end_cnt=if_cnt=0;
 
@@ -1074,7 +1241,7 @@ QString SchemaParser::getCodeDefinition(attribs_map &attribs)
 					atrib=getAttribute();
 
 					//Checks if the attribute extracted belongs to the passed list of attributes
-          if(attributes.count(atrib)==0)
+          if(!hasAttribute(atrib))
 					{
 						if(!ignore_unk_atribs)
 						{
@@ -1113,7 +1280,9 @@ QString SchemaParser::getCodeDefinition(attribs_map &attribs)
 					{
 						/* If the attribute has no value set and parser must not ignore empty values
 						raises an exception */
-            if(attributes[atrib].isEmpty() && !ignore_empty_atribs)
+            word=getAttributeValue(atrib);
+
+            if(word.isEmpty() && !ignore_empty_atribs)
 						{
               throw Exception(QString(Exception::getErrorMessage(ERR_UNDEF_ATTRIB_VALUE))
                               .arg(atrib).arg(filename).arg(line + comment_count +1).arg(column+1),
@@ -1122,7 +1291,7 @@ QString SchemaParser::getCodeDefinition(attribs_map &attribs)
 
 						/* If the parser is not in an if / else, concatenates the value of the attribute
 							directly in definition in sql */
-            object_def+=attributes[atrib];
+            appendDefinition(object_def, word, true);
 					}
 				break;
 
@@ -1280,7 +1449,7 @@ QString SchemaParser::getCodeDefinition(attribs_map &attribs)
 									{
                     //If its an attribute, extracts the name between { } and checks if the same has empty value
                     atrib=word.mid(1, word.size()-2);
-                    word=attributes[atrib];
+                    word=getAttributeValue(atrib);
 
 										/* If the attribute has no value set and parser must not ignore empty values
 										raises an exception */
@@ -1293,7 +1462,7 @@ QString SchemaParser::getCodeDefinition(attribs_map &attribs)
 									}
 
 									//Else, insert the work directly on the object definition
-									object_def+=word;
+									appendDefinition(object_def, word, !(*itr).isEmpty() && (*itr)[0]==CHR_INI_ATTRIB);
 								}
 								itr++;
 							}
@@ -1374,7 +1543,7 @@ QString SchemaParser::getCodeDefinition(attribs_map &attribs)
 					}
 					else
 						//Case the parser is not in 'if/else' concatenates the word/text directly on the object definition
-						object_def+=word;
+						appendDefinition(object_def, word, false);
 				break;
 			}
 		}
@@ -1392,6 +1561,7 @@ QString SchemaParser::getCodeDefinition(attribs_map &attribs)
 	restartParser();
 	ignore_unk_atribs=false;
 	ignore_empty_atribs=false;
+	xml_definition=in_xml_value=false;
 	return(object_def);
 }
 
@@ -29,8 +29,11 @@
 #include "exception.h"
 #include <map>
 #include <vector>
+#include <memory>
 #include <QDir>
 #include <QTextStream>
+#include <QDateTime>
+#include <QMutex>
 #include "xmlparser.h"
 #include "attribsmap.h"
 #include "pgsqlversions.h"
@@ -45,6 +48,13 @@ class SchemaParser {
 		 attributes avoiding raising exceptions */
 		bool ignore_empty_atribs;
 
+		/*! \brief Indicates that the parser is generating a XML definition. In this mode the values of the
+		 attributes written between quotes (tag attributes) have their special chars converted to XML entities */
+		bool xml_definition,
+
+		//! \brief Indicates that the parser is currently writing the value of a tag attribute (inside quotes)
+		in_xml_value;
+
 		static const char CHR_COMMENT,			//! \brief Character that starts a comment
 											CHR_LINE_END,			//! \brief Character that indicates end of line
 											CHR_SPACE,        //! \brief Character that indicates spacing
@@ -162,6 +172,14 @@ class SchemaParser {
 		//! \brief Gets a pure text, ignoring elements of the language
 		QString getPureText(void);
 
+		/*! \brief Appends a text (word, pure text or attribute value) to the object definition. When generating XML code
+		 the values of attributes written inside a tag attribute are converted to XML entities and the quotes of the texts
+		 coming from the schema file are used to know if the parser is inside a tag attribute or not */
+		void appendDefinition(QString &object_def, const QString &text, bool is_attrib_value);
+
+		//! \brief Converts the chars < > " & of an attribute value to the respective XML entities
+		static QString convertValueToXMLEntities(const QString &value);
+
 		/*! \brief Returns whether a character is special i.e. indicators of attributes
 		 or conditional instructions */
 		bool isSpecialCharacter(char chr);
@@ -180,8 +198,55 @@ class SchemaParser {
                   reference to the line on file that has syntax errors */
         comment_count;
 
+		/*! \brief Attributes created (%set) or cleared (%unset) by the buffer being parsed. These
+		 attributes overrides the ones in the map provided by the caller (see ext_attribs) */
 		attribs_map attributes;
 
+		/*! \brief Attributes provided by the caller of getCodeDefinition(). The map is referenced
+		 instead of copied to avoid the allocation of its nodes on every code generation */
+		attribs_map *ext_attribs;
+
+		/*! \brief Attribute references ({name}) of a buffer line indexed by the column of their opening brace.
+		 Each entry stores the attribute name and the column right after the closing brace */
+		typedef map<int, pair<QString, int>> AttribTokens;
+
+		/*! \brief Attribute references resolved once when the schema file was loaded (one entry per buffer line).
+		 The vector is shared with the loaded files cache so reusing a file doesn't copy it. When null (e.g. memory
+		 buffers) the attributes are extracted from the buffer while parsing */
+		shared_ptr<vector<AttribTokens>> attrib_tokens;
+
+		/*! \brief Locates the well-formed attribute references of the buffer. Malformed ones are not resolved
+		 so the parser still scans them and raises the proper syntax errors */
+		static shared_ptr<vector<AttribTokens>> resolveAttributes(const QStringList &buffer);
+
+		//! \brief Stores a schema file already loaded and prepared to be parsed
+		struct SchemaFile {
+			//! \brief Modification date of the file when it was loaded
+			QDateTime last_modified;
+
+			//! \brief Lines of the file without comments (see loadBuffer())
+			QStringList buffer;
+
+			//! \brief Amount of comment lines removed from the file
+			int comment_count;
+
+			//! \brief Attribute references of the buffer resolved when the file was loaded
+			shared_ptr<vector<AttribTokens>> attrib_tokens;
+		};
+
+		/*! \brief Stores the schema files already loaded (indexed by their paths). The files are read
+		 and prepared only once and reloaded only when modified on disk */
+		static map<QString, SchemaFile> loaded_files;
+
+		//! \brief Controls the access to the loaded files since parsers can be used from different threads
+		static QMutex loaded_files_mutex;
+
+		//! \brief Returns if the attribute exists on the attributes created by the buffer or on the caller's attributes
+		bool hasAttribute(const QString &attrib);
+
+		//! \brief Returns the value of the attribute (an empty string is returned for unknown attributes)
+		QString getAttributeValue(const QString &attrib);
+
 		//! \brief PostgreSQL version currently used by the parser
 		QString pgsql_version;
 
@@ -216,7 +281,8 @@ class SchemaParser {
 		//! \brief Loads the buffer with a string
 		void loadBuffer(const QString &buf);
 
-		//! \brief Loads a schema file and inserts its line into the parser's buffer
+		/*! \brief Loads a schema file and inserts its line into the parser's buffer. The prepared
+		 buffer is reused by the next loadings of the same file while it's not modified */
 		void loadFile(const QString &filename);
 
 		//! \brief Resets the parser in order to do new analysis
@@ -228,15 +294,37 @@ class SchemaParser {
     //! \brief Set if the parser must ignore empty attributes avoiding exception throwing
     void ignoreEmptyAttributes(bool ignore);
 
+		//! \brief Returns if the parser is ignoring unknown attributes
+		bool isIgnoringUnkownAttributes(void);
+
+		//! \brief Returns if the parser is ignoring empty attributes
+		bool isIgnoringEmptyAttributes(void);
+
 		//! \brief Retorns the current PostgreSQL version used by the parser
 		QString getPgSQLVersion(void);
 
     //! brief Extracts the attributes names from the currently loaded buffer
     QStringList extractAttributes(void);
 
-		/*! \brief Converts any chars (operators) < > " to the respective XML entities. This method is only
-    called when generating XML code and only tag attributes are treated.*/
+		/*! \brief Converts any chars (operators) < > " to the respective XML entities of the tag attributes
+		in a XML buffer. The XML definitions of objects are already escaped while being generated (see appendDefinition())
+		so this method is needed only for XML code generated through the generic getCodeDefinition() methods */
     static QString convertCharsToXMLEntities(QString buf);
 };
 
+/*! \brief Changes the modes used by a parser to handle unknown and empty attributes restoring the previous
+ modes when the guard leaves the scope. This is used when a parser is shared (e.g. the one used by the
+ model objects) and must return to its previous modes even if the code generation fails */
+class SchemaParserModeGuard {
+	private:
+		SchemaParser &parser;
+
+		//! \brief Modes of the parser before the guard was created
+		bool ignore_unk_atribs, ignore_empty_atribs;
+
+	public:
+		SchemaParserModeGuard(SchemaParser &parser, bool ignore_unk_atribs, bool ignore_empty_atribs);
+		~SchemaParserModeGuard(void);
+};
+
 #endif
@@ -17,7 +17,6 @@
 */
 
 #include "xmlparser.h"
-#include <QUrl>
 
 const QString XMLParser::CHAR_AMP=QString("&amp;");
 const QString XMLParser::CHAR_LT=QString("&lt;");
@@ -25,18 +24,23 @@ const QString XMLParser::CHAR_GT=QString("&gt;");
 const QString XMLParser::CHAR_QUOT=QString("&quot;");
 const QString XMLParser::CHAR_APOS=QString("&apos;");
 
+map<QString, XMLParser::DTDFile> XMLParser::loaded_dtds;
+QMutex XMLParser::loaded_dtds_mutex;
+
 XMLParser::XMLParser(void)
 {
 	root_elem=nullptr;
 	curr_elem=nullptr;
 	xml_doc=nullptr;
+	trusted_input=false;
 	xmlInitParser();
 }
 
 XMLParser::~XMLParser(void)
 {
+	/* Note: xmlCleanupParser() isn't called here anymore since the parsed DTDs are
+	shared by all parser instances and live until the application finishes */
 	restartParser();
-  xmlCleanupParser();
 }
 
 void XMLParser::removeDTD(void)
@@ -83,7 +87,7 @@ void XMLParser::loadXMLFile(const QString &filename)
 			input.close();
 
 			xml_doc_filename=filename;
-			loadXMLBuffer(buffer);
+			loadXMLBuffer(buffer, false);
 		}
 	}
 	catch(Exception &e)
@@ -92,12 +96,14 @@ void XMLParser::loadXMLFile(const QString &filename)
 	}
 }
 
-void XMLParser::loadXMLBuffer(const QString &xml_buf)
+void XMLParser::loadXMLBuffer(const QString &xml_buf, bool trusted)
 {
 	try
 	{
 		int pos1=-1, pos2=-1, tam=0;
 
+		trusted_input=trusted;
+
 		if(xml_buf.isEmpty())
 			throw Exception(ERR_ASG_EMPTY_XML_BUFFER,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
@@ -114,7 +120,9 @@ void XMLParser::loadXMLBuffer(const QString &xml_buf)
 		else
       xml_decl=QString("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
 
-		removeDTD();
+		if(!trusted_input)
+			removeDTD();
+
 		readBuffer();
 	}
 	catch(Exception &e)
@@ -125,26 +133,107 @@ void XMLParser::loadXMLBuffer(const QString &xml_buf)
 
 void XMLParser::setDTDFile(const QString &dtd_file, const QString &dtd_name)
 {
-	QString fmt_dtd_file;
-
 	if(dtd_file.isEmpty())
 		throw Exception(ERR_ASG_EMPTY_DTD_FILE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	if(dtd_name.isEmpty())
 		throw Exception(ERR_ASG_EMPTY_DTD_NAME,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-	#ifndef Q_OS_WIN
-    fmt_dtd_file=QString("file://");
-	#else
-    fmt_dtd_file=QString("file:///");
-	#endif
-
-	//Formats the dtd file path to URL style (converting to percentage format the non reserved chars)
-	fmt_dtd_file=QUrl::toPercentEncoding(QFileInfo(dtd_file).absoluteFilePath(), "/:");
-  dtd_decl=QString("<!DOCTYPE ") + dtd_name +
-           QString(" SYSTEM ") +
-           QString("\"") +
-           fmt_dtd_file + QString("\">\n");
+	//The DTD itself is parsed (once) only when the first document is validated against it
+	this->dtd_file=QFileInfo(dtd_file).absoluteFilePath();
+	this->dtd_name=dtd_name;
+}
+
+xmlDtdPtr XMLParser::getDTD(const QString &dtd_file)
+{
+	QDateTime last_modified=QFileInfo(dtd_file).lastModified();
+	map<QString, DTDFile>::iterator itr=loaded_dtds.find(dtd_file);
+	xmlDtdPtr dtd=nullptr;
+	xmlError *xml_error=nullptr;
+
+	//Reuses the DTD parsed previously if the file wasn't changed since then
+	if(itr!=loaded_dtds.end() && itr->second.last_modified==last_modified)
+		return(itr->second.dtd);
+
+	xmlResetLastError();
+	dtd=xmlParseDTD(nullptr, reinterpret_cast<const xmlChar *>(dtd_file.toUtf8().constData()));
+
+	if(!dtd)
+	{
+		xml_error=xmlGetLastError();
+		throw Exception(QString(Exception::getErrorMessage(ERR_LIBXMLERR))
+										.arg(xml_error ? xml_error->line : 0).arg(xml_error ? xml_error->int2 : 0)
+										.arg(xml_error ? QString(xml_error->message).replace("\n"," ") : QString())
+										.arg(QString("(%1)").arg(dtd_file)),
+										ERR_LIBXMLERR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	if(itr!=loaded_dtds.end())
+		xmlFreeDtd(itr->second.dtd);
+
+	loaded_dtds[dtd_file].last_modified=last_modified;
+	loaded_dtds[dtd_file].dtd=dtd;
+	return(dtd);
+}
+
+void XMLParser::validateDocument(void)
+{
+	QMutexLocker locker(&loaded_dtds_mutex);
+	xmlValidCtxtPtr valid_ctxt=nullptr;
+	xmlNode *root=xmlDocGetRootElement(xml_doc);
+	xmlError *xml_error=nullptr;
+	QString msg, file;
+	int line=0, column=0;
+	bool valid=false;
+
+	try
+	{
+		xmlDtdPtr dtd=getDTD(dtd_file);
+
+		//The document must start with the element declared as the DTD's name
+		if(!root || dtd_name!=reinterpret_cast<const char *>(root->name))
+		{
+			msg=QString("Root element `%1' doesn't match the document type `%2'")
+					.arg(root ? QString(reinterpret_cast<const char *>(root->name)) : QString()).arg(dtd_name);
+			line=(root ? root->line : 0);
+		}
+		else
+		{
+			xmlResetLastError();
+			valid_ctxt=xmlNewValidCtxt();
+			valid=xmlValidateDtd(valid_ctxt, xml_doc, dtd);
+			xmlFreeValidCtxt(valid_ctxt);
+
+			if(!valid)
+			{
+				xml_error=xmlGetLastError();
+
+				if(xml_error)
+				{
+					msg=xml_error->message;
+					file=xml_error->file;
+					line=xml_error->line;
+					column=xml_error->int2;
+				}
+			}
+		}
+	}
+	catch(Exception &e)
+	{
+		restartParser();
+		throw Exception(e.getErrorMessage(), e.getErrorType(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+
+	if(!valid)
+	{
+		if(!file.isEmpty()) file=QString("(%1)").arg(file);
+		msg.replace("\n"," ");
+		restartParser();
+
+		throw Exception(QString(Exception::getErrorMessage(ERR_LIBXMLERR))
+										.arg(line).arg(column).arg(msg).arg(file),
+										ERR_LIBXMLERR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
 }
 
 void XMLParser::readBuffer(void)
@@ -159,19 +248,10 @@ void XMLParser::readBuffer(void)
 		//Inserts the XML declaration
 		buffer+=xml_decl;
 
-		//Configures the parser, initially, to not validate the document against the dtd
+		/* Configures the parser to not validate the document against the dtd. The validation
+		is made after the parsing against the DTD parsed only once (see validateDocument()) */
 		parser_opt=( XML_PARSE_NOBLANKS | XML_PARSE_NONET | XML_PARSE_NOENT );
 
-		//If the dtd declarions is setup
-		if(!dtd_decl.isEmpty())
-		{
-			//Inserts the default software DTD declarion into XML buffer
-			buffer+=dtd_decl;
-
-			//Now configures the parser to validate the buffer against the DTD
-			parser_opt=(parser_opt | XML_PARSE_DTDLOAD | XML_PARSE_DTDVALID);
-		}
-
 		buffer+=xml_buffer;
 
 		//Create an xml document from the buffer
@@ -198,6 +278,10 @@ void XMLParser::readBuffer(void)
 											ERR_LIBXMLERR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		}
 
+		//Validates the document against the cached DTD (if configured)
+		if(!dtd_file.isEmpty() && !trusted_input)
+			validateDocument();
+
 		//Gets the referênce to the root element on the document
 		root_elem=curr_elem=xmlDocGetRootElement(xml_doc);
 	}
@@ -256,7 +340,7 @@ void XMLParser::restartParser(void)
 		xmlFreeDoc(xml_doc);
 		xml_doc=nullptr;
 	}
-  dtd_decl=xml_buffer=xml_decl=QString();
+  dtd_file=dtd_name=xml_buffer=xml_decl=QString();
 
 	while(!elems_stack.empty())
 		elems_stack.pop();
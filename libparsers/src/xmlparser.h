@@ -28,11 +28,14 @@
 
 #include <libxml/parser.h>
 #include <libxml/tree.h>
+#include <libxml/valid.h>
 #include "schemaparser.h"
 #include "exception.h"
 #include <stack>
 #include <iostream>
 #include "attribsmap.h"
+#include <QMutex>
+#include <QDateTime>
 
 using namespace std;
 
@@ -56,20 +59,49 @@ class XMLParser {
 		 position is necessary call restorePosition() */
 		stack<xmlNode *> elems_stack;
 
-		//! \brief Stores the document DTD declaration
-		QString	dtd_decl,
+		//! \brief Stores the path to the DTD file used to validate the document
+		QString	dtd_file,
+										//! \brief Stores the name of the DTD (the expected root element)
+										dtd_name,
 										//! \brief Stores XML document to be analyzed
 										xml_buffer,
 										/*! \brief Stores the declaration <?xml?>. If this isn't exists it will be
 										 a default declaration. */
 										xml_decl;
 
+		/*! \brief Indicates that the buffer being loaded was generated by pgModeler itself, this way
+		 the DTD validation and the removal of the document's DTD are skipped (see loadXMLBuffer()) */
+		bool trusted_input;
+
+		//! \brief Stores a DTD already parsed and shared by all the parser instances
+		struct DTDFile {
+			//! \brief Modification date of the file when it was parsed
+			QDateTime last_modified;
+
+			//! \brief The DTD parsed by libxml2 (including the external entities it references)
+			xmlDtdPtr dtd;
+		};
+
+		/*! \brief Stores the DTDs already parsed (indexed by their paths). Each DTD is parsed only
+		 once for the whole process and parsed again only when its file is modified on disk */
+		static map<QString, DTDFile> loaded_dtds;
+
+		/*! \brief Controls the access to the loaded DTDs. The validation itself is also done while holding it
+		 since libxml2 builds the content models of the elements on the DTD (shared) during the validation */
+		static QMutex loaded_dtds_mutex;
+
+		//! \brief Returns the parsed DTD of the file, parsing it if needed. The mutex loaded_dtds_mutex must be held by the caller
+		static xmlDtdPtr getDTD(const QString &dtd_file);
+
+		//! \brief Validates the generated document against the configured DTD raising an error if it is not valid
+		void validateDocument(void);
+
 		/*! \brief Remove the original DTD from the document. This is done to evit that
 		 the user insert some external dtd in the model file that is not valid for pgModeler */
 		void removeDTD(void);
 
 		/*! \brief Makes the interpretation of XML inside the buffer validating it according to
-		 DTD defined configured (by the parser) to the buffer. Initializes
+		 DTD configured (by the parser) to the buffer (see validateDocument()). Initializes
 		 the necessary attributes to make possible the navigation through the element tree
 		 generated from the XML document read. */
 		void readBuffer(void);
@@ -93,8 +125,9 @@ class XMLParser {
 		//! \brief Loads the XML buffer from a file
 		void loadXMLFile(const QString &filename);
 
-		//! \brief Loads the XML buffer from a string
-		void loadXMLBuffer(const QString &xml_buf);
+		/*! \brief Loads the XML buffer from a string. The trusted parameter must be true only for XML generated
+		 by pgModeler itself (e.g. the code of objects being imported) causing the validation against the DTD to be skipped */
+		void loadXMLBuffer(const QString &xml_buf, bool trusted=false);
 
 		//! \brief Informs the DTD file used to make element validations
 		void setDTDFile(const QString &dtd_file, const QString &dtd_name);
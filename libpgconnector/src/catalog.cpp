@@ -16,6 +16,7 @@
 # Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
 */
 #include "catalog.h"
+#include <algorithm>
 
 const QString Catalog::QUERY_LIST=QString("list");
 const QString Catalog::QUERY_ATTRIBS=QString("attribs");
@@ -25,6 +26,15 @@ const QString Catalog::PGSQL_FALSE=QString("f");
 const QString Catalog::BOOL_FIELD=QString("_bool");
 const QString Catalog::ARRAY_PATTERN=QString("((\\[)[0-9]+(\\:)[0-9]+(\\])=)?(\\{)((.)+(,)*)*(\\})$");
 const QString Catalog::GET_EXT_OBJS_SQL=QString("SELECT objid AS oid FROM pg_depend WHERE objid > 0 AND refobjid > 0 AND deptype='e'");
+const QString Catalog::GET_DEPENDENCIES_SQL=QString("SELECT DISTINCT COALESCE(rw.ev_class, ad.adrelid, dp.objid) AS oid, COALESCE(tp.typelem, dp.refobjid) AS ref_oid \
+FROM (SELECT classid, objid, refclassid, refobjid FROM pg_depend WHERE objid > 0 AND refobjid > 0 AND deptype IN ('n','a') \
+AND NOT (deptype='a' AND classid='pg_class'::regclass AND objid IN (SELECT oid FROM pg_class WHERE relkind='S')) \
+UNION ALL SELECT classid, objid, refclassid, refobjid FROM pg_shdepend WHERE objid > 0 AND refobjid > 0 AND deptype='o' \
+AND dbid=(SELECT oid FROM pg_database WHERE datname=current_database())) AS dp \
+LEFT JOIN pg_rewrite AS rw ON dp.classid='pg_rewrite'::regclass AND rw.oid=dp.objid \
+LEFT JOIN pg_attrdef AS ad ON dp.classid='pg_attrdef'::regclass AND ad.oid=dp.objid \
+LEFT JOIN pg_type AS tp ON dp.refclassid='pg_type'::regclass AND tp.oid=dp.refobjid AND tp.typelem > 0 AND tp.typlen=-1 \
+WHERE COALESCE(rw.ev_class, ad.adrelid, dp.objid) > %1");
 
 bool Catalog::use_cached_queries=false;
 attribs_map Catalog::catalog_queries;
@@ -64,7 +74,6 @@ void Catalog::setConnection(Connection &conn)
 	try
 	{
 		ResultSet res;
-		QStringList ext_obj;
 
     connection.close();
     connection.setConnectionParams(conn.getConnectionParams());
@@ -81,16 +90,15 @@ void Catalog::setConnection(Connection &conn)
 		}
 
 		//Retrieving the list of objects created by extensions
+    ext_obj_oids.clear();
     this->connection.executeDMLCommand(GET_EXT_OBJS_SQL, res);
 		if(res.accessTuple(ResultSet::FIRST_TUPLE))
 		{
 			do
 			{
-        ext_obj.push_back(res.getColumnValue(QString("oid")));
+        ext_obj_oids.insert(res.getColumnValue(QString("oid")).toUInt());
 			}
 			while(res.accessTuple(ResultSet::NEXT_TUPLE));
-
-      ext_obj_oids=ext_obj.join(',');
 		}
 	}
 	catch(Exception &e)
@@ -133,7 +141,39 @@ unsigned Catalog::getLastSysObjectOID(void)
 
 bool Catalog::isExtensionObject(unsigned oid)
 {
-	return(ext_obj_oids.contains(QString::number(oid)));
+	return(ext_obj_oids.count(oid) > 0);
+}
+
+map<unsigned, vector<unsigned>> Catalog::getObjectsDependencies(void)
+{
+	try
+	{
+		ResultSet res;
+		map<unsigned, vector<unsigned>> deps;
+		unsigned oid=0, ref_oid=0;
+
+		connection.executeDMLCommand(GET_DEPENDENCIES_SQL.arg(last_sys_oid), res);
+
+		if(res.accessTuple(ResultSet::FIRST_TUPLE))
+		{
+			do
+			{
+				oid=QString(res.getColumnValue(0)).toUInt();
+				ref_oid=QString(res.getColumnValue(1)).toUInt();
+
+				//Dependencies on system objects and self references (e.g. a view's rule on the view) are discarded
+				if(ref_oid > last_sys_oid && ref_oid!=oid)
+					deps[oid].push_back(ref_oid);
+			}
+			while(res.accessTuple(ResultSet::NEXT_TUPLE));
+		}
+
+		return(deps);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
 }
 
 void Catalog::loadCatalogQuery(const QString &qry_id)
@@ -323,20 +363,19 @@ attribs_map Catalog::getAttributes(const QString &obj_name, ObjectType obj_type,
 	try
 	{
 		ResultSet res;
-		attribs_map obj_attribs;
+		vector<attribs_map> obj_attribs;
 
 		//Add the name of the object as extra attrib in order to retrieve the data only for it
 		extra_attribs[ParsersAttributes::NAME]=obj_name;
 		executeCatalogQuery(QUERY_ATTRIBS, obj_type, res, true, extra_attribs);
-
-		if(res.accessTuple(ResultSet::FIRST_TUPLE))
-			obj_attribs=changeAttributeNames(res.getTupleValues());
+		obj_attribs=getTuplesAttributes(res, obj_type);
 
 		/* Insert the object type as an attribute of the query result to facilitate the
 		import process on the classes that uses the Catalog */
-		obj_attribs[ParsersAttributes::OBJECT_TYPE]=QString("%1").arg(obj_type);
+		if(obj_attribs.empty())
+			return(attribs_map{{ParsersAttributes::OBJECT_TYPE, QString("%1").arg(obj_type)}});
 
-		return(obj_attribs);
+		return(std::move(obj_attribs.front()));
 	}
 	catch(Exception &e)
 	{
@@ -349,27 +388,9 @@ vector<attribs_map> Catalog::getMultipleAttributes(ObjectType obj_type, attribs_
 	try
 	{
 		ResultSet res;
-		attribs_map tuple;
-		vector<attribs_map> obj_attribs;
 
 		executeCatalogQuery(QUERY_ATTRIBS, obj_type, res, false, extra_attribs);
-		if(res.accessTuple(ResultSet::FIRST_TUPLE))
-		{
-			do
-			{
-				tuple=changeAttributeNames(res.getTupleValues());
-
-				/* Insert the object type as an attribute of the query result to facilitate the
-				import process on the classes that uses the Catalog */
-				tuple[ParsersAttributes::OBJECT_TYPE]=QString("%1").arg(obj_type);
-
-				obj_attribs.push_back(tuple);
-				tuple.clear();
-			}
-			while(res.accessTuple(ResultSet::NEXT_TUPLE));
-		}
-
-		return(obj_attribs);
+		return(getTuplesAttributes(res, obj_type));
 	}
 	catch(Exception &e)
 	{
@@ -402,8 +423,15 @@ QString Catalog::getNotExtObjectQuery(const QString &oid_field)
 
 	try
 	{
-		attribs_map attribs={{ParsersAttributes::OID, oid_field},
-												 {ParsersAttributes::EXT_OBJ_OIDS, ext_obj_oids}};
+		QStringList oids;
+		attribs_map attribs;
+
+		//The oids are serialized only here since the query is the only place that needs them as text
+		for(unsigned oid : ext_obj_oids)
+			oids.push_back(QString::number(oid));
+
+		attribs[ParsersAttributes::OID]=oid_field;
+		attribs[ParsersAttributes::EXT_OBJ_OIDS]=oids.join(',');
 
 
     loadCatalogQuery(query_id);
@@ -442,6 +470,63 @@ attribs_map Catalog::changeAttributeNames(const attribs_map &attribs)
 	return(new_attribs);
 }
 
+vector<attribs_map> Catalog::getTuplesAttributes(ResultSet &res, ObjectType obj_type)
+{
+	vector<attribs_map> tuples;
+	vector<pair<QString, int>> columns;
+	vector<bool> bool_cols;
+	attribs_map tuple;
+	QString attr_name, type_name=QString("%1").arg(obj_type);
+	char *value=nullptr;
+	int col_count=res.getColumnCount(), col=0;
+
+	if(!res.accessTuple(ResultSet::FIRST_TUPLE))
+		return(tuples);
+
+	//Translating the column names only once for the whole result set (see changeAttributeNames)
+	for(col=0; col < col_count; col++)
+	{
+		attr_name=res.getColumnName(col);
+		bool_cols.push_back(attr_name.endsWith(BOOL_FIELD));
+
+		if(bool_cols.back())
+			attr_name.remove(BOOL_FIELD);
+
+		attr_name.replace('_','-');
+		columns.push_back(make_pair(attr_name, col));
+	}
+
+	/* Sorting the columns by their translated names so the values of each tuple can be
+	appended at the end of the map instead of searching for the insertion point */
+	std::stable_sort(columns.begin(), columns.end(),
+									 [](const pair<QString, int> &col_a, const pair<QString, int> &col_b){ return(col_a.first < col_b.first); });
+
+	tuples.reserve(res.getTupleCount());
+
+	do
+	{
+		for(auto &column : columns)
+		{
+			value=res.getColumnValue(column.second);
+
+			if(bool_cols[column.second])
+				tuple.emplace_hint(tuple.end(), column.first, (PGSQL_FALSE==value ? QString() : ParsersAttributes::_TRUE_));
+			else
+				tuple.emplace_hint(tuple.end(), column.first, QString(value));
+		}
+
+		/* Insert the object type as an attribute of the query result to facilitate the
+		import process on the classes that uses the Catalog */
+		tuple[ParsersAttributes::OBJECT_TYPE]=type_name;
+
+		tuples.push_back(std::move(tuple));
+		tuple.clear();
+	}
+	while(res.accessTuple(ResultSet::NEXT_TUPLE));
+
+	return(tuples);
+}
+
 QString Catalog::createOidFilter(const vector<unsigned> &oids)
 {
 	QString filter;
@@ -30,6 +30,7 @@ This class is the basis for the reverse engineering feature.
 #include "baseobject.h"
 #include "tableobject.h"
 #include <QTextStream>
+#include <set>
 #include <QApplication>
 
 class Catalog {
@@ -46,12 +47,15 @@ class Catalog {
     //! \brief Query used to retrieve extension objects.
     GET_EXT_OBJS_SQL,
 
+		//! \brief Query used to retrieve the dependencies between user objects (see getObjectsDependencies())
+		GET_DEPENDENCIES_SQL,
+
 		//! \brief This pattern matches the PostgreSQL array values in format [n:n]={a,b,c,d,...} or {a,b,c,d,...}
 		ARRAY_PATTERN;
 
-		/*! \brief Stores in comma seperated way the oids of all objects created by extensions. This
-		attribute is use when filtering objects that are created by extensions */
-		QString ext_obj_oids;
+		/*! \brief Stores the oids of all objects created by extensions. This attribute is used when
+		filtering objects that are created by extensions (see isExtensionObject() and getNotExtObjectQuery()) */
+		set<unsigned> ext_obj_oids;
 
 		/*! \brief This map stores the oid field name for each object type. The oid field name can be
 		composed by the pg_[OBJECT_TYPE] table alias. Refer to catalog query schema files for details */
@@ -105,6 +109,12 @@ class Catalog {
 		the resultant attribs_map will be passed to XMLParser/SchemaParser which understands bool values as 1 (one) or '' (empty) */
 		attribs_map changeAttributeNames(const attribs_map &attribs);
 
+		/*! \brief Returns the attributes of all the tuples of the result set already changed as done by changeAttributeNames()
+		and with the object type inserted. The column names are translated only once per result set and shared (implicitly)
+		by all the returned maps, and the values are inserted in the maps in key order, avoiding the creation of an
+		intermediate map per tuple as happens when calling changeAttributeNames(res.getTupleValues()) */
+		vector<attribs_map> getTuplesAttributes(ResultSet &res, ObjectType obj_type);
+
 		//! \brief Returns a attribute set for the specified object type and name
 		attribs_map getAttributes(const QString &obj_name, ObjectType obj_type, attribs_map extra_attribs=attribs_map());
 
@@ -156,6 +166,13 @@ class Catalog {
 		//! \brief Returns if the specified oid is amongst the extension created objects' oids
 		bool isExtensionObject(unsigned oid);
 
+		/*! \brief Returns the dependencies between the user objects (oid of the object -> oids of the objects it references)
+		registered on pg_depend (normal and automatic) and the ownerships registered on pg_shdepend. The dependencies of the
+		view's rewrite rules are returned as dependencies of the view itself, the ones of column defaults as dependencies of the
+		table and array types are replaced by their element types. The ownership of sequences by columns (OWNED BY) is discarded
+		so a sequence used by a column default (e.g. serial) is created before the table */
+		map<unsigned, vector<unsigned>> getObjectsDependencies(void);
+
 		/*! \brief Returns the count for the specified object type. A schema name can be specified
 		in order to filter only objects of the specifed schema */
     unsigned getObjectCount(ObjectType obj_type, const QString &sch_name=QString(), const QString &tab_name=QString(), attribs_map extra_attribs=attribs_map());
@@ -58,7 +58,10 @@ HEADERS += src/textbox.h \
 	   src/extension.h \
 	   src/pgmodelerns.h \
            src/tag.h \
-           src/eventtrigger.h
+           src/eventtrigger.h \
+           src/objectssearchindex.h \
+           src/modeljournal.h \
+           src/modelcache.h
 
 
 SOURCES +=  src/textbox.cpp \
@@ -106,7 +109,10 @@ SOURCES +=  src/textbox.cpp \
 	    src/pgmodelerns.cpp \
             src/tag.cpp \
             src/eventtrigger.cpp \
-    src/operation.cpp
+    src/operation.cpp \
+    src/objectssearchindex.cpp \
+    src/modeljournal.cpp \
+    src/modelcache.cpp
 
 unix|windows: LIBS += -L$$OUT_PWD/../libparsers/ -lparsers \
                     -L$$OUT_PWD/../libutils/ -lutils
@@ -233,6 +233,7 @@ QString Aggregate::getCodeDefinition(unsigned def_type)
 {
 	QString code_def=getCachedCode(def_type, false);
 	if(!code_def.isEmpty()) return(code_def);
+	CodeGenerationGuard gen_guard(this);
 
 	setTypesAttribute(def_type);
 
@@ -71,7 +71,10 @@ void BaseGraphicObject::setPositionAttribute(void)
 
 void  BaseGraphicObject::setPosition(QPointF pos)
 {
-	setCodeInvalidated(position != pos);
+	//The position is written only on the object's own code so the dependents remain valid
+	if(position != pos)
+		setOwnCodeInvalidated();
+
 	position=pos;
 }
 
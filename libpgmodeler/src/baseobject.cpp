@@ -65,12 +65,27 @@ QString BaseObject::objs_sql[OBJECT_TYPE_COUNT]={
    DatabaseModel, Tag */
 unsigned BaseObject::global_id=4000;
 
+std::atomic<unsigned long long> BaseObject::global_mod_id(0);
+
 QString BaseObject::pgsql_ver=PgSQLVersions::DEFAULT_VERSION;
 bool BaseObject::use_cached_code=true;
 
+map<BaseObject *, set<BaseObject *>> BaseObject::code_dependents;
+map<BaseObject *, set<BaseObject *>> BaseObject::code_dependencies;
+QMutex BaseObject::code_deps_mutex;
+thread_local vector<BaseObject *> BaseObject::code_gen_stack;
+thread_local vector<pair<BaseObject *, BaseObject *>> BaseObject::pending_code_deps;
+bool BaseObject::check_cached_code=(getenv("PGMODELER_CHECK_CODE_CACHE")!=nullptr);
+thread_local bool BaseObject::checking_cached_code=false;
+
+thread_local SchemaParser BaseObject::schparser;
+map<ObjectType, set<QString>> BaseObject::attribs_names;
+QMutex BaseObject::attribs_names_mutex;
+
 BaseObject::BaseObject(void)
 {
 	object_id=BaseObject::global_id++;
+	modification_id=++BaseObject::global_mod_id;
 	is_protected=system_obj=sql_disabled=false;
 	code_invalidated=true;
 	obj_type=BASE_OBJECT;
@@ -94,6 +109,15 @@ BaseObject::BaseObject(void)
 	this->setName(QApplication::translate("BaseObject","new_object","", -1));
 }
 
+BaseObject::~BaseObject(void)
+{
+	//The code of the dependents references this object so it must be generated again
+	invalidateDependentsCode();
+	removeCodeDependencies();
+	discardPendingCodeDependencies();
+	finishCodeGeneration();
+}
+
 unsigned BaseObject::getGlobalId(void)
 {
 	return(global_id);
@@ -481,8 +505,13 @@ void BaseObject::setSchema(BaseObject *schema)
 	else if(!acceptsSchema())
 		throw Exception(ERR_ASG_INV_SCHEMA_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
+	BaseObject *prev_schema=this->schema;
+
 	setCodeInvalidated(this->schema != schema);
 	this->schema=schema;
+
+	if(database && prev_schema!=schema)
+		database->updateSchemaIndex(this, prev_schema);
 }
 
 void BaseObject::setOwner(BaseObject *owner)
@@ -538,6 +567,8 @@ void BaseObject::setPrependedSQL(const QString &sql)
 
 QString BaseObject::getName(bool format, bool prepend_schema)
 {
+	registerCodeDependency();
+
 	if(format)
 	{
 		QString aux_name;
@@ -649,6 +680,8 @@ bool BaseObject::isSystemObject(void)
 
 void BaseObject::setBasicAttributes(bool format_name)
 {
+  restoreAttributes();
+
   if(attributes[ParsersAttributes::NAME].isEmpty())
     attributes[ParsersAttributes::NAME]=this->getName(format_name);
 
@@ -678,6 +711,7 @@ QString BaseObject::getCodeDefinition(unsigned def_type, bool reduced_form)
     bool format=false;
 
 		schparser.setPgSQLVersion(BaseObject::pgsql_ver);
+		cached_sql_ver=BaseObject::pgsql_ver;
     attributes[ParsersAttributes::SQL_DISABLED]=(sql_disabled ? ParsersAttributes::_TRUE_ : QString());
 
 		//Formats the object's name in case the SQL definition is being generated
@@ -750,7 +784,7 @@ QString BaseObject::getCodeDefinition(unsigned def_type, bool reduced_form)
 					obj_type!=OBJ_DATABASE) ||
 				 def_type==SchemaParser::XML_DEFINITION)
 			{
-				schparser.ignoreUnkownAttributes(true);
+				SchemaParserModeGuard guard(schparser, true, schparser.isIgnoringEmptyAttributes());
 
         attributes[ParsersAttributes::COMMENT]=
 						schparser.getCodeDefinition(ParsersAttributes::COMMENT, attributes, def_type);
@@ -763,7 +797,7 @@ QString BaseObject::getCodeDefinition(unsigned def_type, bool reduced_form)
 
 			if(def_type==SchemaParser::XML_DEFINITION)
 			{
-				schparser.ignoreUnkownAttributes(true);
+				SchemaParserModeGuard guard(schparser, true, schparser.isIgnoringEmptyAttributes());
 				attributes[ParsersAttributes::APPENDED_SQL]=
             schparser.getCodeDefinition(QString(ParsersAttributes::APPENDED_SQL).remove('-'), attributes, def_type);
 			}
@@ -779,7 +813,7 @@ QString BaseObject::getCodeDefinition(unsigned def_type, bool reduced_form)
 
       if(def_type==SchemaParser::XML_DEFINITION)
       {
-				schparser.ignoreUnkownAttributes(true);
+				SchemaParserModeGuard guard(schparser, true, schparser.isIgnoringEmptyAttributes());
         attributes[ParsersAttributes::PREPENDED_SQL]=
             schparser.getCodeDefinition(QString(ParsersAttributes::PREPENDED_SQL).remove('-'), attributes, def_type);
       }
@@ -799,6 +833,10 @@ QString BaseObject::getCodeDefinition(unsigned def_type, bool reduced_form)
 
 		try
 		{
+			/* The object's definition is always parsed in strict mode since some objects are validated by checking
+			the errors raised for undefined attributes (e.g. Table::addObject()) */
+			SchemaParserModeGuard guard(schparser, false, false);
+
 			code_def+=schparser.getCodeDefinition(objs_schemas[obj_type], attributes, def_type);
 
 			//Internally disabling the SQL definition
@@ -831,7 +869,7 @@ QString BaseObject::getCodeDefinition(unsigned def_type, bool reduced_form)
 		}
 		catch(Exception &e)
 		{
-			schparser.restartParser();
+			restartSchemaParser();
 			clearAttributes();
 
 			if(e.getErrorType()==ERR_UNDEF_ATTRIB_VALUE)
@@ -854,16 +892,34 @@ void BaseObject::setAttribute(const QString &attrib, const QString &value)
 
 void BaseObject::clearAttributes(void)
 {
-	attribs_map::iterator itr, itr_end;
+	QMutexLocker locker(&attribs_names_mutex);
+	set<QString> &names=attribs_names[obj_type];
 
-	itr=attributes.begin();
-	itr_end=attributes.end();
+	//Stores the names of the attributes so they can be restored on the next generation
+	for(auto &attr : attributes)
+		names.insert(attr.first);
 
-	while(itr!=itr_end)
-	{
-    itr->second=QString();
-		itr++;
-	}
+	attributes.clear();
+}
+
+void BaseObject::restoreAttributes(void)
+{
+	QMutexLocker locker(&attribs_names_mutex);
+	map<ObjectType, set<QString>>::iterator itr=attribs_names.find(obj_type);
+
+	if(itr==attribs_names.end())
+		return;
+
+	//The attributes already configured by the subclasses are preserved
+	for(auto &name : itr->second)
+		attributes.emplace(name, QString());
+}
+
+void BaseObject::restartSchemaParser(void)
+{
+	schparser.restartParser();
+	schparser.ignoreUnkownAttributes(false);
+	schparser.ignoreEmptyAttributes(false);
 }
 
 void BaseObject::swapObjectsIds(BaseObject *obj1, BaseObject *obj2, bool enable_cl_obj_swap)
@@ -895,6 +951,10 @@ void BaseObject::swapObjectsIds(BaseObject *obj1, BaseObject *obj2, bool enable_
 		unsigned id_bkp=obj1->object_id;
 		obj1->object_id=obj2->object_id;
 		obj2->object_id=id_bkp;
+
+		//The ids define the objects order so the swapping is registered as a modification of both objects
+		obj1->modification_id=++BaseObject::global_mod_id;
+		obj2->modification_id=++BaseObject::global_mod_id;
   }
 }
 
@@ -964,6 +1024,21 @@ QString BaseObject::getPgSQLVersion(void)
 	return(pgsql_ver);
 }
 
+unsigned BaseObject::getSavedMemoryPerObject(ObjectType obj_type)
+{
+	QMutexLocker locker(&attribs_names_mutex);
+	map<ObjectType, set<QString>>::iterator itr=attribs_names.find(obj_type);
+
+	/* Each attribute kept between the generations costs a tree node (color and three links)
+		 holding the name and the value. The names share their data with the ParsersAttributes
+		 constants and the values are empty so only the nodes themselves are considered */
+	unsigned node_size=sizeof(attribs_map::value_type) + (4 * sizeof(void *)),
+			attribs_size=(itr!=attribs_names.end() ? itr->second.size() * node_size : 0);
+
+	//The version of the cached sql code is the only field added to the objects
+	return(sizeof(SchemaParser) - sizeof(QString) + attribs_size);
+}
+
 void BaseObject::enableCachedCode(bool value)
 {
 	use_cached_code=value;
@@ -971,6 +1046,8 @@ void BaseObject::enableCachedCode(bool value)
 
 void BaseObject::operator = (BaseObject &obj)
 {
+	BaseObject *prev_schema=this->schema, *prev_db=this->database;
+
 	this->owner=obj.owner;
 	this->schema=obj.schema;
 	this->tablespace=obj.tablespace;
@@ -981,22 +1058,150 @@ void BaseObject::operator = (BaseObject &obj)
 	this->is_protected=obj.is_protected;
 	this->sql_disabled=obj.sql_disabled;
   this->system_obj=obj.system_obj;
+	this->modification_id=++BaseObject::global_mod_id;
 	this->setCodeInvalidated(use_cached_code);
+
+	//The database that owned the object before the copy is the one that indexes it by schema
+	if(prev_db && prev_schema!=schema)
+		prev_db->updateSchemaIndex(this, prev_schema);
 }
 
 void BaseObject::setCodeInvalidated(bool value)
 {
-	if(use_cached_code && value!=code_invalidated)
+	if(value)
+	{
+		setOwnCodeInvalidated();
+		invalidateDependentsCode();
+	}
+	else if(use_cached_code)
+		code_invalidated=false;
+}
+
+void BaseObject::setOwnCodeInvalidated(void)
+{
+	modification_id=++BaseObject::global_mod_id;
+
+	if(use_cached_code)
+	{
+		cached_reduced_code.clear();
+		cached_code[0].clear();
+		cached_code[1].clear();
+		code_invalidated=true;
+	}
+
+	//The dependencies are registered again when the code is regenerated
+	removeCodeDependencies();
+}
+
+void BaseObject::invalidateDependentsCode(void)
+{
+	map<BaseObject *, set<BaseObject *>>::iterator itr;
+	set<BaseObject *> dependents;
+
+	//The dependencies registered by the generations still running on this thread must be invalidated too
+	mergeCodeDependencies();
+
+	{
+		QMutexLocker locker(&code_deps_mutex);
+
+		itr=code_dependents.find(this);
+
+		if(itr==code_dependents.end())
+			return;
+
+		/* The list is detached before the invalidation so each dependent is visited only once
+			 even if there are circular dependencies between the objects. The lock is released
+			 before the invalidation since the dependents update the lists too */
+		dependents=itr->second;
+		code_dependents.erase(itr);
+	}
+
+	/* The non-virtual version of setCodeInvalidated() is used since the dependents registered
+		 during the code generation are enough to reach all the affected objects. Additionally,
+		 this method is called by the destructor when the subclasses are already destroyed */
+	for(auto object : dependents)
+		object->BaseObject::setCodeInvalidated(true);
+}
+
+void BaseObject::removeCodeDependencies(void)
+{
+	QMutexLocker locker(&code_deps_mutex);
+	map<BaseObject *, set<BaseObject *>>::iterator itr=code_dependencies.find(this), itr_dep;
+
+	if(itr==code_dependencies.end())
+		return;
+
+	for(auto object : itr->second)
 	{
-		if(value)
+		itr_dep=code_dependents.find(object);
+
+		if(itr_dep!=code_dependents.end())
 		{
-			cached_reduced_code.clear();
-			cached_code[0].clear();
-			cached_code[1].clear();
+			itr_dep->second.erase(this);
+
+			if(itr_dep->second.empty())
+				code_dependents.erase(itr_dep);
 		}
+	}
+
+	code_dependencies.erase(itr);
+}
+
+void BaseObject::registerCodeDependency(void)
+{
+	BaseObject *dependent=nullptr;
+
+	if(!use_cached_code || code_gen_stack.empty())
+		return;
+
+	dependent=code_gen_stack.back();
+
+	/* The database model doesn't cache its code so there is no need to track its dependencies.
+		 Consecutive registrations of the same pair (e.g. the schema name of several attributes) are stored once */
+	if(dependent!=this && dependent->obj_type!=OBJ_DATABASE &&
+		 (pending_code_deps.empty() || pending_code_deps.back()!=make_pair(this, dependent)))
+		pending_code_deps.push_back(make_pair(this, dependent));
+}
+
+void BaseObject::startCodeGeneration(void)
+{
+	if(use_cached_code)
+		code_gen_stack.push_back(this);
+}
+
+void BaseObject::finishCodeGeneration(void)
+{
+	vector<BaseObject *>::reverse_iterator itr=std::find(code_gen_stack.rbegin(), code_gen_stack.rend(), this);
+
+	if(itr!=code_gen_stack.rend())
+		code_gen_stack.erase(std::next(itr).base());
+
+	if(code_gen_stack.empty())
+		mergeCodeDependencies();
+}
+
+void BaseObject::mergeCodeDependencies(void)
+{
+	if(pending_code_deps.empty())
+		return;
+
+	QMutexLocker locker(&code_deps_mutex);
 
-		code_invalidated=value;
+	for(auto &dep : pending_code_deps)
+	{
+		code_dependents[dep.first].insert(dep.second);
+		code_dependencies[dep.second].insert(dep.first);
 	}
+
+	pending_code_deps.clear();
+}
+
+void BaseObject::discardPendingCodeDependencies(void)
+{
+	pending_code_deps.erase(std::remove_if(pending_code_deps.begin(), pending_code_deps.end(),
+																				 [&](const pair<BaseObject *, BaseObject *> &dep){
+																					 return(dep.first==this || dep.second==this);
+																				 }), pending_code_deps.end());
 }
 
 bool BaseObject::isCodeInvalidated(void)
@@ -1004,6 +1209,16 @@ bool BaseObject::isCodeInvalidated(void)
 	return(use_cached_code && code_invalidated);
 }
 
+unsigned long long BaseObject::getModificationId(void)
+{
+	return(modification_id);
+}
+
+unsigned long long BaseObject::getGlobalModificationId(void)
+{
+	return(BaseObject::global_mod_id);
+}
+
 bool BaseObject::isCodeDiffersFrom(const QString &xml_def1, const QString &xml_def2, const vector<QString> &ignored_attribs, const vector<QString> &ignored_tags)
 {
   QString xml, tag=QString("<%1").arg(this->getSchemaName()),
@@ -1069,15 +1284,20 @@ bool BaseObject::isCodeDiffersFrom(BaseObject *object, const vector<QString> &ig
 
 QString BaseObject::getCachedCode(unsigned def_type, bool reduced_form)
 {
-	if(use_cached_code && def_type==SchemaParser::SQL_DEFINITION && schparser.getPgSQLVersion()!=BaseObject::pgsql_ver)
+	if(use_cached_code && def_type==SchemaParser::SQL_DEFINITION && cached_sql_ver!=BaseObject::pgsql_ver)
 		code_invalidated=true;
 
+	//The object being generated (if any) uses the code of this one
+	registerCodeDependency();
+
 	if(!code_invalidated &&
 		 ((!reduced_form && !cached_code[def_type].isEmpty()) ||
 			(def_type==SchemaParser::XML_DEFINITION  && reduced_form && !cached_reduced_code.isEmpty())))
 	{
 		if(def_type==SchemaParser::XML_DEFINITION  && reduced_form)
 			return(cached_reduced_code);
+		else if(check_cached_code && !checking_cached_code)
+			return(checkCachedCode(def_type));
 		else
 			return(cached_code[def_type]);
 	}
@@ -1085,6 +1305,32 @@ QString BaseObject::getCachedCode(unsigned def_type, bool reduced_form)
     return(QString());
 }
 
+QString BaseObject::checkCachedCode(unsigned def_type)
+{
+	QString cached_def=cached_code[def_type], code_def;
+
+	//Forces the regeneration of the code without invalidating the dependents
+	checking_cached_code=true;
+	code_invalidated=true;
+
+	try
+	{
+		code_def=getCodeDefinition(def_type);
+		checking_cached_code=false;
+	}
+	catch(Exception &e)
+	{
+		checking_cached_code=false;
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+
+	if(code_def!=cached_def)
+		qDebug("stale cached %s code for %s (%s)!", (def_type==SchemaParser::SQL_DEFINITION ? "SQL" : "XML"),
+					 this->getName(true).toStdString().c_str(), this->getTypeName().toStdString().c_str());
+
+	return(code_def);
+}
+
 QString BaseObject::getDropDefinition(bool cascade)
 {
   try
@@ -1092,11 +1338,10 @@ QString BaseObject::getDropDefinition(bool cascade)
     if(acceptsDropCommand())
     {
       attribs_map attribs;
+      SchemaParserModeGuard guard(schparser, true, true);
 
       setBasicAttributes(true);
       schparser.setPgSQLVersion(BaseObject::pgsql_ver);
-      schparser.ignoreUnkownAttributes(true);
-      schparser.ignoreEmptyAttributes(true);
 
       attribs=attributes;
 
@@ -1114,6 +1359,7 @@ QString BaseObject::getDropDefinition(bool cascade)
   }
   catch(Exception &e)
   {
+    restartSchemaParser();
     throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
   }
 }
@@ -1122,18 +1368,18 @@ QString BaseObject::getAlterDefinition(QString sch_name, attribs_map &attribs, b
 {
   try
   {
-    SchemaParser schparser;
     QString alter_sch_dir=GlobalAttributes::SCHEMAS_ROOT_DIR + GlobalAttributes::DIR_SEPARATOR +
                           GlobalAttributes::ALTER_SCHEMA_DIR + GlobalAttributes::DIR_SEPARATOR +
                           QString("%1") + GlobalAttributes::SCHEMA_EXT;
 
+    SchemaParserModeGuard guard(schparser, ignore_ukn_attribs, ignore_empty_attribs);
+
     schparser.setPgSQLVersion(BaseObject::pgsql_ver);
-    schparser.ignoreEmptyAttributes(ignore_empty_attribs);
-    schparser.ignoreUnkownAttributes(ignore_ukn_attribs);
     return(schparser.getCodeDefinition(alter_sch_dir.arg(sch_name), attribs));
   }
   catch(Exception &e)
   {
+    restartSchemaParser();
     throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
   }
 }
@@ -1200,8 +1446,7 @@ QString BaseObject::getAlterDefinition(BaseObject *object, bool ignore_name_diff
         else
           attributes[ParsersAttributes::COMMENT]=object->getComment();
 
-        schparser.ignoreUnkownAttributes(true);
-        schparser.ignoreEmptyAttributes(true);
+        SchemaParserModeGuard guard(schparser, true, true);
         alter+=schparser.getCodeDefinition(ParsersAttributes::COMMENT, attributes, SchemaParser::SQL_DEFINITION);
       }
     }
@@ -1213,3 +1458,14 @@ QString BaseObject::getAlterDefinition(BaseObject *object, bool ignore_name_diff
     return(alter);
   }
 }
+
+CodeGenerationGuard::CodeGenerationGuard(BaseObject *object)
+{
+	this->object=object;
+	object->startCodeGeneration();
+}
+
+CodeGenerationGuard::~CodeGenerationGuard(void)
+{
+	object->finishCodeGeneration();
+}
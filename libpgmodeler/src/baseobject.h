@@ -31,9 +31,12 @@
 #include "schemaparser.h"
 #include "xmlparser.h"
 #include <map>
+#include <set>
+#include <atomic>
 #include <QRegExp>
 #include <QStringList>
 #include <QTextStream>
+#include <QMutex>
 
 using namespace ParsersAttributes;
 
@@ -85,8 +88,21 @@ class BaseObject {
 		//! \brief Stores the database wich the object belongs
 		BaseObject *database;
 
+		/*! \brief Stores, for each object type, the names of the attributes used on the code generation.
+		 The attributes map of the objects is released after the generation and these names are used to
+		 restore the attributes (with empty values) on the next generation (see setBasicAttributes()) */
+		static map<ObjectType, set<QString>> attribs_names;
+
+		//! \brief Controls the access to the attributes names since the code can be generated from different threads
+		static QMutex attribs_names_mutex;
+
+		//! \brief Restores the attributes used by the object type without changing the values already set
+		void restoreAttributes(void);
+
   protected:
-		SchemaParser schparser;
+		/*! \brief Parser shared by the objects on the current thread. The parser is restarted after
+		 each code generation so there is no need to keep one instance per object */
+		static thread_local SchemaParser schparser;
 
 		/*! \brief This static attribute is used to generate the unique identifier for objects.
 		 As object instances are created this value ​​are incremented. In some classes
@@ -126,10 +142,47 @@ class BaseObject {
 				generate it again */
 		code_invalidated;
 
+		/*! brief Stores the value of the global modification counter when the object was created or had
+				its code invalidated for the last time. Differently from code_invalidated this value is updated
+				even when the cached code is disabled and is used by external caches to detect outdated entries */
+		unsigned long long modification_id;
+
+		/*! brief Global modification counter used to generate the modification_id of the objects. The counter
+				is atomic since objects are created and invalidated from different threads (e.g. import, temporary saving) */
+		static std::atomic<unsigned long long> global_mod_id;
+
 		//! brief Stores the cached xml and sql code
 		QString cached_code[2],
 		//! brief Stores the xml code in reduced form
-						cached_reduced_code;
+						cached_reduced_code,
+		//! brief Stores the PostgreSQL version used on the last code generation (see getCachedCode())
+						cached_sql_ver;
+
+		/*! brief Stores, for each object, the objects which cached code was generated using its code or its name.
+				These objects have their code invalidated together with the object (see invalidateDependentsCode()) */
+		static map<BaseObject *, set<BaseObject *>> code_dependents;
+
+		//! brief Stores the reverse relation of code_dependents (object -> objects used to generate its cached code)
+		static map<BaseObject *, set<BaseObject *>> code_dependencies;
+
+		//! brief Controls the access to code_dependents and code_dependencies since the code can be generated from different threads
+		static QMutex code_deps_mutex;
+
+		/*! brief Stores the objects which code is being generated on the current thread (the last one is the innermost generation).
+				The dependencies of the cached code are registered for the last object in this stack (see CodeGenerationGuard) */
+		static thread_local vector<BaseObject *> code_gen_stack;
+
+		/*! brief Stores the dependencies (object used, object being generated) registered on the current thread. They are
+				merged into code_dependents and code_dependencies at once when the outermost generation finishes, this way
+				the lock is not acquired for each name or code retrieved during the generation */
+		static thread_local vector<pair<BaseObject *, BaseObject *>> pending_code_deps;
+
+		/*! brief Indicates that the cached code must be compared with a freshly generated one every time it's
+				returned. This debug mode is enabled by defining the environment variable PGMODELER_CHECK_CODE_CACHE */
+		static bool check_cached_code;
+
+		//! brief Indicates that a cached code is being checked on the current thread (avoids checking nested cached codes)
+		static thread_local bool checking_cached_code;
 
 		/*! \brief This map stores the name of each object type associated to a schema file
 		 that generates the object's code definition */
@@ -173,7 +226,8 @@ class BaseObject {
 
 		/*! \brief Stores the attributes and their values ​​shaped in strings to be used
 		 by SchemaParser on the object's code definition creation. The attribute
-		 name related to model objects are defined in ParsersAttributes namespace. */
+		 name related to model objects are defined in ParsersAttributes namespace.
+		 This map is released at the end of each code generation (see clearAttributes()) */
 		attribs_map attributes;
 
 		/*! \brief Type of object, may have one of the values ​​of the enum ObjectType OBJ_*
@@ -190,6 +244,10 @@ class BaseObject {
 							 if the user calls getDatabase() in further operations may result in crash */
 		void setDatabase(BaseObject *db);
 
+		/*! \brief Called on the database that owns the object when the schema of the latter changes.
+		The default implementation does nothing (see DatabaseModel::updateSchemaIndex()) */
+		virtual void updateSchemaIndex(BaseObject *, BaseObject *){}
+
 		/*! \brief Swap the the ids of the specified objects. The method will raise errors if the objects are the same,
 		or some of them are system object. The boolean param enables the id swap between ordinary object and
 		cluster level objects (database, tablespace and roles). */
@@ -198,15 +256,53 @@ class BaseObject {
     //! brief Changes the current object id to the most recent global id value.
     static void updateObjectId(BaseObject *obj);
 
-    //! \brief Clears all the attributes used by the SchemaParser
+    /*! \brief Releases all the attributes used by the SchemaParser. The names of the attributes are
+        stored so they can be restored on the next code generation (see restoreAttributes()) */
     void clearAttributes(void);
 
+    //! \brief Restarts the shared parser discarding the options configured by a failed code generation
+    static void restartSchemaParser(void);
+
 		/*! brief Returns the cached code for the specified code type. This method returns an empty
-		 string in case of no code is cached */
+		 string in case of no code is cached. In that case, the code must be generated under a CodeGenerationGuard */
 		QString getCachedCode(unsigned def_type, bool reduced_form);
 
+		/*! brief Registers the object which code is being generated (if any) as a dependent of this object, this way
+				the cached code of the former is invalidated when this object changes. This method is called automatically
+				when the name or the cached code of the object is retrieved and must be called by the subclasses that
+				return their signatures without calling getName() */
+		void registerCodeDependency(void);
+
+		//! brief Invalidates the code of the objects registered as dependents of this one (and of their dependents)
+		void invalidateDependentsCode(void);
+
+		//! brief Removes the object from the dependents lists of the objects used to generate its cached code
+		void removeCodeDependencies(void);
+
+		//! brief Pushes the object into the code generation stack of the current thread
+		void startCodeGeneration(void);
+
+		/*! brief Removes the object from the code generation stack. When the stack gets empty the dependencies
+				registered by the finished generations are merged (see mergeCodeDependencies()) */
+		void finishCodeGeneration(void);
+
+		//! brief Moves the dependencies registered on the current thread into the shared dependencies lists
+		static void mergeCodeDependencies(void);
+
+		//! brief Discards the dependencies registered on the current thread (and not merged yet) that reference the object
+		void discardPendingCodeDependencies(void);
+
+		/*! brief Generates the code again and compares it with the cached one reporting any difference.
+				This method is used only when the cached code checking is enabled (see check_cached_code) */
+		QString checkCachedCode(unsigned def_type);
+
+		/*! brief Invalidates the cached code of the object without propagating the invalidation to its dependents.
+				This method is used when the changed attribute is written only on the object's own code (e.g. position) */
+		void setOwnCodeInvalidated(void);
+
     /*! brief Configures the DIF_SQL attribute depending on the type of the object. This attribute is used to know how
-        ALTER, COMMENT and DROP commands must be generated. Refer to schema files for comments, drop and alter. */
+        ALTER, COMMENT and DROP commands must be generated. Refer to schema files for comments, drop and alter.
+        The attributes released at the end of the last code generation are restored by this method. */
     void setBasicAttributes(bool format_name);
 
     /*! brief Compares two xml buffers and returns if they differs from each other. The user can specify which attributes
@@ -227,7 +323,7 @@ class BaseObject {
 
 		BaseObject(void);
 		BaseObject(bool system_obj);
-		virtual ~BaseObject(void){}
+		virtual ~BaseObject(void);
 
 		//! \brief Returns the reference to the database that owns the object
 		BaseObject *getDatabase(void);
@@ -426,13 +522,22 @@ class BaseObject {
 		/*! brief Marks the current cached code as invalid and forces its regenaration.
 				Some key attributes / setters in the base classes BaseObject, BaseTable and BaseRelationship
 				will automatically invalidate the code but for all other setters / attributes the user must call
-				this method explicitly in order to force the regeneration of the code.
+				this method explicitly in order to force the regeneration of the code. The invalidation is propagated
+				to the objects which cached code was generated using this object (see registerCodeDependency()).
 				This method has no effect when the cached code support is disables. See enableCachedCode() */
 		virtual void setCodeInvalidated(bool value);
 
 		//! brief Returns if the code (sql and xml) is invalidated
 		bool isCodeInvalidated(void);
 
+		/*! brief Returns the modification id of the object. This value changes every time the object's code
+				is invalidated so it can be compared with a previous value to know if the object was modified */
+		unsigned long long getModificationId(void);
+
+		/*! brief Returns the current value of the global modification counter. This value changes every time
+				an object is created or has its code invalidated so it can be used to detect changes in any object */
+		static unsigned long long getGlobalModificationId(void);
+
 		/*! brief Compares the xml code between the "this" object and another one. The user can specify which attributes
 		and tags must be ignored when makin the comparison. NOTE: only the name for attributes and tags must be informed */
 		virtual bool isCodeDiffersFrom(BaseObject *object, const vector<QString> &ignored_attribs={}, const vector<QString> &ignored_tags={});
@@ -461,10 +566,29 @@ class BaseObject {
 		//! brief Returns the current version for SQL code generation
 		static QString getPgSQLVersion(void);
 
+		/*! brief Returns an estimate of the memory (in bytes) that each object of the specified type doesn't keep allocated
+				between the code generations since the parser is shared and the attributes map is built only during the generation.
+				The estimate considers only the attributes already used on the code generation of the objects of the type */
+		static unsigned getSavedMemoryPerObject(ObjectType obj_type);
+
 		friend class DatabaseModel;
 		friend class ModelValidationHelper;
 		friend class DatabaseImportHelper;
 		friend class SwapObjectsIdsWidget;
+		friend class CodeGenerationGuard;
+};
+
+/*! \brief Marks the code of an object as being generated on the current thread while the guard exists, this way the objects
+ used in the generation are registered as dependencies of its cached code (see BaseObject::registerCodeDependency()).
+ This guard must be created by the subclasses after checking the cached code (see BaseObject::getCachedCode()) and
+ ensures that the object leaves the code generation stack even on early returns or exceptions */
+class CodeGenerationGuard {
+	private:
+		BaseObject *object;
+
+	public:
+		CodeGenerationGuard(BaseObject *object);
+		~CodeGenerationGuard(void);
 };
 
 #endif
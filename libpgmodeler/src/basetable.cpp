@@ -17,6 +17,7 @@
 */
 
 #include "basetable.h"
+#include "databasemodel.h"
 
 BaseTable::BaseTable(void)
 {
@@ -36,6 +37,14 @@ Tag *BaseTable::getTag(void)
   return(tag);
 }
 
+void BaseTable::removeFromSearchIndex(BaseObject *object)
+{
+	DatabaseModel *model=dynamic_cast<DatabaseModel *>(getDatabase());
+
+	if(model)
+		model->removeFromSearchIndex(object);
+}
+
 QString BaseTable::getAlterDefinition(BaseObject *object)
 {
   try
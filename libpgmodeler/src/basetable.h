@@ -33,6 +33,10 @@ class BaseTable: public BaseGraphicObject {
   protected:
     Tag *tag;
 
+		/*! \brief Drops a removed child object from the search index of the model that owns the table
+		(see DatabaseModel::removeFromSearchIndex()) */
+		void removeFromSearchIndex(BaseObject *object);
+
 	public:
 		BaseTable(void);
 
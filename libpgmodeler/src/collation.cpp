@@ -99,6 +99,7 @@ QString Collation::getCodeDefinition(unsigned def_type, bool reduced_form)
 {
 	QString code_def=getCachedCode(def_type, reduced_form);
 	if(!code_def.isEmpty()) return(code_def);
+	CodeGenerationGuard gen_guard(this);
 
 	if(!locale.isEmpty())
 	{
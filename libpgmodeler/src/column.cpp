@@ -152,6 +152,7 @@ QString Column::getCodeDefinition(unsigned def_type)
 {
 	QString code_def=getCachedCode(def_type, false);
 	if(!code_def.isEmpty()) return(code_def);
+	CodeGenerationGuard gen_guard(this);
 
   if(getParentTable())
     attributes[ParsersAttributes::TABLE]=getParentTable()->getName(true);
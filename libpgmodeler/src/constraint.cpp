@@ -654,6 +654,7 @@ QString Constraint::getCodeDefinition(unsigned def_type, bool inc_addedbyrel)
 {
 	QString code_def=getCachedCode(def_type, false);
   if(!inc_addedbyrel && !code_def.isEmpty()) return(code_def);
+	CodeGenerationGuard gen_guard(this);
 
 	QString attrib;
 
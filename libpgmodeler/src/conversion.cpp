@@ -114,6 +114,7 @@ QString Conversion::getCodeDefinition(unsigned def_type)
 {
 	QString code_def=getCachedCode(def_type, false);
 	if(!code_def.isEmpty()) return(code_def);
+	CodeGenerationGuard gen_guard(this);
 
 	attributes[ParsersAttributes::DEFAULT]=(is_default ? ParsersAttributes::_TRUE_ : QString());
 	attributes[ParsersAttributes::SRC_ENCODING]=(~encodings[SRC_ENCODING]);
@@ -18,6 +18,7 @@
 
 #include "databasemodel.h"
 #include "pgmodelerns.h"
+#include <QCryptographicHash>
 
 unsigned DatabaseModel::dbmodel_id=2000;
 
@@ -35,6 +36,7 @@ DatabaseModel::DatabaseModel(void)
   default_objs[OBJ_COLLATION]=nullptr;
 
 	conn_limit=-1;
+	change_id=0;
   last_zoom=1;
   loading_model=invalidated=append_at_eod=prepend_at_bod=false;
 	attributes[ParsersAttributes::ENCODING]=QString();
@@ -427,6 +429,8 @@ void DatabaseModel::__addObject(BaseObject *object, int obj_idx)
 			obj_list->push_back(object);
 	}
 
+	addSchemaIndexEntry(object, object->getSchema());
+	change_id++;
 	object->setDatabase(this);
 	emit s_objectAdded(object);
 	this->setInvalidated(true);
@@ -493,6 +497,9 @@ void DatabaseModel::__removeObject(BaseObject *object, int obj_idx, bool check_r
 			{
 				removePermissions(object);
 				obj_list->erase(obj_list->begin() + obj_idx);
+				removeFromSearchIndex(object);
+				removeSchemaIndexEntry(object, object->getSchema());
+				change_id++;
 			}
 		}
 
@@ -505,6 +512,8 @@ vector<BaseObject *> DatabaseModel::getObjects(ObjectType obj_type, BaseObject *
 {
 	vector<BaseObject *> *obj_list=nullptr, sel_list;
 	vector<BaseObject *>::iterator itr, itr_end;
+	map<BaseObject *, map<ObjectType, vector<BaseObject *>>>::iterator sch_itr;
+	map<ObjectType, vector<BaseObject *>>::iterator type_itr;
   BaseRelationship *rel=nullptr;
 
 	obj_list=getObjectList(obj_type);
@@ -512,6 +521,22 @@ vector<BaseObject *> DatabaseModel::getObjects(ObjectType obj_type, BaseObject *
 	if(!obj_list)
 		throw Exception(ERR_OBT_OBJ_INVALID_TYPE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
+	//The objects that accept schemas are retrieved directly from the schema index
+	if(BaseObject::acceptsSchema(obj_type))
+	{
+		sch_itr=schema_objs.find(schema);
+
+		if(sch_itr!=schema_objs.end())
+		{
+			type_itr=sch_itr->second.find(obj_type);
+
+			if(type_itr!=sch_itr->second.end())
+				sel_list=type_itr->second;
+		}
+
+		return(sel_list);
+	}
+
 	itr=obj_list->begin();
 	itr_end=obj_list->end();
 
@@ -532,30 +557,82 @@ vector<BaseObject *> DatabaseModel::getObjects(ObjectType obj_type, BaseObject *
 
 vector<BaseObject *> DatabaseModel::getObjects(BaseObject *schema)
 {
-	vector<BaseObject *> *obj_list=nullptr, sel_list;
-	vector<BaseObject *>::iterator itr, itr_end;
+	vector<BaseObject *> sel_list;
+	map<BaseObject *, map<ObjectType, vector<BaseObject *>>>::iterator sch_itr;
+	map<ObjectType, vector<BaseObject *>>::iterator type_itr;
 	ObjectType types[]={	OBJ_FUNCTION, OBJ_TABLE, OBJ_VIEW, OBJ_DOMAIN,
 												OBJ_AGGREGATE, OBJ_OPERATOR, OBJ_SEQUENCE, OBJ_CONVERSION,
 												OBJ_TYPE, OBJ_OPCLASS, OBJ_OPFAMILY, OBJ_COLLATION,	OBJ_EXTENSION };
 	unsigned i, count=sizeof(types)/sizeof(ObjectType);
 
+	sch_itr=schema_objs.find(schema);
+
+	if(sch_itr==schema_objs.end())
+		return(sel_list);
+
 	for(i=0; i < count; i++)
 	{
-		obj_list=getObjectList(types[i]);
-		itr=obj_list->begin();
-		itr_end=obj_list->end();
+		type_itr=sch_itr->second.find(types[i]);
 
-		while(itr!=itr_end)
-		{
-			if((*itr)->getSchema()==schema)
-				sel_list.push_back(*itr);
-			itr++;
-		}
+		if(type_itr!=sch_itr->second.end())
+			sel_list.insert(sel_list.end(), type_itr->second.begin(), type_itr->second.end());
 	}
 
 	return(sel_list);
 }
 
+void DatabaseModel::addSchemaIndexEntry(BaseObject *object, BaseObject *schema)
+{
+	if(object && object->acceptsSchema())
+		schema_objs[schema][object->getObjectType()].push_back(object);
+}
+
+bool DatabaseModel::removeSchemaIndexEntry(BaseObject *object, BaseObject *schema)
+{
+	map<BaseObject *, map<ObjectType, vector<BaseObject *>>>::iterator sch_itr;
+	map<ObjectType, vector<BaseObject *>>::iterator type_itr;
+	vector<BaseObject *>::iterator itr;
+
+	if(!object || !object->acceptsSchema())
+		return(false);
+
+	sch_itr=schema_objs.find(schema);
+
+	if(sch_itr==schema_objs.end())
+		return(false);
+
+	type_itr=sch_itr->second.find(object->getObjectType());
+
+	if(type_itr==sch_itr->second.end())
+		return(false);
+
+	itr=std::find(type_itr->second.begin(), type_itr->second.end(), object);
+
+	if(itr==type_itr->second.end())
+		return(false);
+
+	type_itr->second.erase(itr);
+
+	//Removing the empty entries so the index doesn't keep references to removed schemas
+	if(type_itr->second.empty())
+	{
+		sch_itr->second.erase(type_itr);
+
+		if(sch_itr->second.empty())
+			schema_objs.erase(sch_itr);
+	}
+
+	return(true);
+}
+
+void DatabaseModel::updateSchemaIndex(BaseObject *object, BaseObject *prev_schema)
+{
+	/* Objects not inserted on the model (e.g. copies stored by the operations history) share the
+		 database reference but aren't indexed, so they are ignored here */
+	if(removeSchemaIndexEntry(object, prev_schema))
+		addSchemaIndexEntry(object, object->getSchema());
+}
+
 BaseObject *DatabaseModel::getObject(const QString &name, ObjectType obj_type, int &obj_idx)
 {
 	BaseObject *object=nullptr;
@@ -646,6 +723,32 @@ unsigned DatabaseModel::getObjectCount(void)
 	return(count);
 }
 
+map<ObjectType, unsigned> DatabaseModel::getObjectCountByType(void)
+{
+	map<ObjectType, unsigned> counts;
+	vector<ObjectType> tab_types=BaseObject::getChildObjectTypes(OBJ_TABLE),
+			view_types={ OBJ_TRIGGER, OBJ_RULE };
+	BaseTable *tab=nullptr;
+
+	counts[OBJ_DATABASE]=1;
+
+	for(auto type : BaseObject::getObjectTypes(false, { OBJ_DATABASE }))
+		counts[type]=getObjectList(type)->size();
+
+	for(auto type : { OBJ_TABLE, OBJ_VIEW })
+	{
+		for(auto object : *getObjectList(type))
+		{
+			tab=dynamic_cast<BaseTable *>(object);
+
+			for(auto tab_type : (type==OBJ_TABLE ? tab_types : view_types))
+				counts[tab_type]+=tab->getObjectCount(tab_type);
+		}
+	}
+
+	return(counts);
+}
+
 QString DatabaseModel::getLocalization(unsigned localiz_id)
 {
 	if(localiz_id > Collation::_LC_COLLATE)
@@ -732,6 +835,10 @@ void DatabaseModel::destroyObjects(void)
   //Removing the special objects first
   storeSpecialObjectsXML();
 	disconnectRelationships();
+	search_idx.clear();
+	obj_permissions.clear();
+	schema_objs.clear();
+	change_id++;
 
 	for(i=0; i < cnt; i++)
 	{
@@ -2592,17 +2699,18 @@ void DatabaseModel::addPermission(Permission *perm)
 
 		TableObject *tab_obj=dynamic_cast<TableObject *>(perm->getObject());
 
-		if(getPermissionIndex(perm) >=0)
+		if(getDuplicatedPermission(perm))
 		{
 			throw Exception(Exception::getErrorMessage(ERR_ASG_DUPLIC_PERMISSION)
                       .arg(/*Utf8String::create(*/perm->getObject()->getName())
 											.arg(perm->getObject()->getTypeName()),
 											ERR_ASG_DUPLIC_PERMISSION,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		}
-		//Raises an error if the permission is referencing an object that does not exists on model
+		/* Raises an error if the permission is referencing an object that does not exists on model.
+			 The objects inserted on the model are the ones that have it assigned as their database */
 		else if(perm->getObject()!=this &&
-						((tab_obj && (getObjectIndex(tab_obj->getParentTable()) < 0)) ||
-						 (!tab_obj && (getObjectIndex(perm->getObject()) < 0))))
+						((tab_obj && (!tab_obj->getParentTable() || tab_obj->getParentTable()->getDatabase()!=this)) ||
+						 (!tab_obj && perm->getObject()->getDatabase()!=this)))
 			throw Exception(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL)
                       .arg(/*Utf8String::create(*/perm->getName())
                       .arg(/*Utf8String::create(*/perm->getObject()->getTypeName())
@@ -2611,6 +2719,8 @@ void DatabaseModel::addPermission(Permission *perm)
 											ERR_ASG_DUPLIC_PERMISSION,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 		permissions.push_back(perm);
+		obj_permissions[perm->getObject()].push_back(perm);
+		change_id++;
 		perm->setDatabase(this);
 	}
 	catch(Exception &e)
@@ -2631,7 +2741,21 @@ void DatabaseModel::removePermission(Permission *perm)
 {
 	try
 	{
-		__removeObject(perm);
+		vector<BaseObject *>::iterator itr=std::find(permissions.begin(), permissions.end(), perm);
+		map<BaseObject *, vector<Permission *>>::iterator perm_itr;
+
+		//Passing the index of the permission avoids its searching by signature
+		__removeObject(perm, (itr!=permissions.end() ? itr - permissions.begin() : -1));
+
+		perm_itr=obj_permissions.find(perm->getObject());
+
+		if(perm_itr!=obj_permissions.end())
+		{
+			perm_itr->second.erase(std::remove(perm_itr->second.begin(), perm_itr->second.end(), perm), perm_itr->second.end());
+
+			if(perm_itr->second.empty())
+				obj_permissions.erase(perm_itr);
+		}
 	}
 	catch(Exception &e)
 	{
@@ -2641,102 +2765,83 @@ void DatabaseModel::removePermission(Permission *perm)
 
 void DatabaseModel::removePermissions(BaseObject *object)
 {
-	vector<BaseObject *>::iterator itr, itr_end;
-	Permission *perm=nullptr;
-	unsigned idx=0;
+	map<BaseObject *, vector<Permission *>>::iterator perm_itr;
+	set<BaseObject *> rem_perms;
 
 	if(!object)
 		throw Exception(ERR_OPR_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-	itr=permissions.begin();
-	itr_end=permissions.end();
+	perm_itr=obj_permissions.find(object);
 
-	while(itr!=itr_end)
-	{
-		perm=dynamic_cast<Permission *>(*itr);
+	//Most of the objects have no permissions so the permissions list is scanned only when needed
+	if(perm_itr==obj_permissions.end())
+		return;
 
-		if(perm->getObject()==object)
-		{
-			permissions.erase(itr);
-			itr=itr_end=permissions.end();
+	rem_perms.insert(perm_itr->second.begin(), perm_itr->second.end());
+	obj_permissions.erase(perm_itr);
+	change_id++;
 
-			if(!permissions.empty())
-				itr=permissions.begin() + idx;
-		}
-		else
-		{ itr++; idx++; }
-	}
+	permissions.erase(std::remove_if(permissions.begin(), permissions.end(),
+																	 [&rem_perms](BaseObject *perm){ return(rem_perms.count(perm)!=0); }),
+										permissions.end());
 }
 
 void DatabaseModel::getPermissions(BaseObject *object, vector<Permission *> &perms)
 {
-	vector<BaseObject *>::iterator itr, itr_end;
-	Permission *perm=nullptr;
+	map<BaseObject *, vector<Permission *>>::iterator perm_itr;
 
 	if(!object)
 		throw Exception(ERR_OPR_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-	itr=permissions.begin();
-	itr_end=permissions.end();
-
 	perms.clear();
+	perm_itr=obj_permissions.find(object);
 
-	while(itr!=itr_end)
-	{
-		perm=dynamic_cast<Permission *>(*itr);
-
-		if(perm->getObject()==object)
-			perms.push_back(perm);
-
-		itr++;
-	}
+	if(perm_itr!=obj_permissions.end())
+		perms=perm_itr->second;
 }
 
-int DatabaseModel::getPermissionIndex(Permission *perm)
+Permission *DatabaseModel::getDuplicatedPermission(Permission *perm)
 {
-	int perm_idx=-1;
-
-	if(perm)
-	{
-		Permission *perm_aux=nullptr;
-		vector<BaseObject *>::iterator itr, itr_end;
-		BaseObject *object=nullptr;
-		Role *role=nullptr;
-		unsigned count, i;
-		bool ref_role=false;
+	map<BaseObject *, vector<Permission *>>::iterator perm_itr;
+	unsigned count, i;
+	bool ref_role=false;
 
-		itr=permissions.begin();
-		itr_end=permissions.end();
+	if(!perm)
+		return(nullptr);
 
-		object=perm->getObject();
+	perm_itr=obj_permissions.find(perm->getObject());
 
-		while(itr!=itr_end && perm_idx < 0)
-		{
-			perm_aux=dynamic_cast<Permission *>(*itr);
+	if(perm_itr==obj_permissions.end())
+		return(nullptr);
 
-			/* When the object of the auxiliary permission is the same as the
-			specified permission it will be check if the existant roles are
-			the same on both permissions */
-			if(object==perm_aux->getObject())
-			{
-				count=perm->getRoleCount();
+	count=perm->getRoleCount();
 
-				for(i=0; i < count && !ref_role; i++)
-				{
-					role=perm->getRole(i);
-					ref_role=perm_aux->isRoleExists(role);
-				}
-			}
+	//Only the permissions applied to the same object need to be compared
+	for(auto perm_aux : perm_itr->second)
+	{
+		ref_role=false;
 
-			//If the permissions references the same roles but one is a REVOKE and other GRANT they a considered different
-			if(perm==perm_aux || (ref_role && perm->isRevoke()==perm_aux->isRevoke()))
-				perm_idx=itr-permissions.begin();
+		for(i=0; i < count && !ref_role; i++)
+			ref_role=perm_aux->isRoleExists(perm->getRole(i));
 
-			itr++;
-		}
+		//If the permissions references the same roles but one is a REVOKE and other GRANT they a considered different
+		if(perm==perm_aux || (ref_role && perm->isRevoke()==perm_aux->isRevoke()))
+			return(perm_aux);
 	}
 
-  return(perm_idx);
+	return(nullptr);
+}
+
+int DatabaseModel::getPermissionIndex(Permission *perm)
+{
+	Permission *perm_aux=getDuplicatedPermission(perm);
+	vector<BaseObject *>::iterator itr;
+
+	if(!perm_aux)
+		return(-1);
+
+	itr=std::find(permissions.begin(), permissions.end(), perm_aux);
+	return(itr!=permissions.end() ? itr - permissions.begin() : -1);
 }
 
 BaseObject *DatabaseModel::getObject(const QString &name, ObjectType obj_type)
@@ -2813,6 +2918,8 @@ void DatabaseModel::loadModel(const QString &filename)
     bool protected_model=false;
     QStringList pos_str;
     map<ObjectType, QString> def_objs;
+    QByteArray file_hash, signature;
+    unsigned cache_flags=0, prev_flags=0;
 
     //Configuring the path to the base path for objects DTD
     dtd_file=GlobalAttributes::SCHEMAS_ROOT_DIR +
@@ -2827,10 +2934,15 @@ void DatabaseModel::loadModel(const QString &filename)
       loading_model=true;
 			xmlparser.restartParser();
 
-      //Loads the root DTD
-			xmlparser.setDTDFile(dtd_file + GlobalAttributes::ROOT_DTD +
-                            GlobalAttributes::OBJECT_DTD_EXT,
-                            GlobalAttributes::ROOT_DTD);
+      //Checks which loading steps can be skipped due to a previous loading of the same file contents
+      file_hash=ModelCache::getFileHash(filename);
+      cache_flags=prev_flags=ModelCache::readCache(file_hash);
+
+      //Loads the root DTD (not needed when the same file contents were already validated)
+      if(!(cache_flags & ModelCache::VALIDATED_DTD))
+        xmlparser.setDTDFile(dtd_file + GlobalAttributes::ROOT_DTD +
+                              GlobalAttributes::OBJECT_DTD_EXT,
+                              GlobalAttributes::ROOT_DTD);
 
       //Loads the file validating it against the root DTD
 			xmlparser.loadXMLFile(filename);
@@ -2930,13 +3042,26 @@ void DatabaseModel::loadModel(const QString &filename)
       loading_model=false;
 
       /* If there are relationship make an last relationship validation to
-      recreate any special object left behind */
-      if(!relationships.empty())
+      recreate any special object left behind. This step is skipped when a previous loading
+      of the same file contents proved that the validation doesn't change the model */
+      if(!relationships.empty() && !(cache_flags & ModelCache::STABLE_RELATIONSHIPS))
       {
+        signature=getStructureSignature();
         storeSpecialObjectsXML();
         disconnectRelationships();
         validateRelationships();
+
+        if(signature==getStructureSignature())
+          cache_flags|=ModelCache::STABLE_RELATIONSHIPS;
       }
+      else if(relationships.empty())
+        cache_flags|=ModelCache::STABLE_RELATIONSHIPS;
+
+      //At this point the file was successfully validated so the cache is updated if needed
+      cache_flags|=ModelCache::VALIDATED_DTD;
+
+      if(cache_flags!=prev_flags)
+        ModelCache::writeCache(file_hash, cache_flags);
 
       this->setInvalidated(false);
       this->setObjectsModified({OBJ_RELATIONSHIP, BASE_RELATIONSHIP});
@@ -6265,7 +6390,6 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 {
   attribs_map attribs_aux;
   float general_obj_cnt, gen_defs_count;
-  bool sql_disabled=false;
   BaseObject *object=nullptr;
   QString def, search_path=QString("pg_catalog,public"),
       msg=trUtf8("Generating %1 of the object `%2' (%3)"),
@@ -6321,16 +6445,7 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
         {
           /* The Database has the SQL code definition disabled when generating the
           code of the entire model because this object cannot be created from a multiline sql command */
-
-          //Saving the sql disabled state
-          sql_disabled=this->isSQLDisabled();
-
-          //Disables the sql to generate a commented code
-          this->setSQLDisabled(true);
-          attribs_aux[this->getSchemaName()]+=this->__getCodeDefinition(def_type);
-
-          //Restore the original sql disabled state
-          this->setSQLDisabled(sql_disabled);
+          attribs_aux[this->getSchemaName()]+=getDisabledSQLDefinition(this);
         }
         else
           attribs_aux[attrib]+=this->__getCodeDefinition(def_type);
@@ -6354,17 +6469,7 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
         /* The Tablespace has the SQL code definition disabled when generating the
           code of the entire model because this object cannot be created from a multiline sql command */
         if(obj_type==OBJ_TABLESPACE && !object->isSystemObject() && def_type==SchemaParser::SQL_DEFINITION)
-        {
-          //Saving the sql disabled state
-          sql_disabled=object->isSQLDisabled();
-
-          //Disables the sql to generate a commented code
-          object->setSQLDisabled(true);
-          attribs_aux[attrib_aux]+=object->getCodeDefinition(def_type);
-
-          //Restore the original sql disabled state
-          object->setSQLDisabled(sql_disabled);
-        }
+          attribs_aux[attrib_aux]+=getDisabledSQLDefinition(object);
         //System object doesn't has the XML generated (the only exception is for public schema)
         else if((obj_type!=OBJ_SCHEMA && !object->isSystemObject()) ||
                 (obj_type==OBJ_SCHEMA &&
@@ -6402,15 +6507,7 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
     attribs_aux[ParsersAttributes::PGMODELER_VERSION]=GlobalAttributes::PGMODELER_VERSION;
 
     if(def_type==SchemaParser::XML_DEFINITION)
-    {
-      attribs_aux[ParsersAttributes::PROTECTED]=(this->is_protected ? ParsersAttributes::_TRUE_ : QString());
-      attribs_aux[ParsersAttributes::LAST_POSITION]=QString("%1,%2").arg(last_pos.x()).arg(last_pos.y());
-      attribs_aux[ParsersAttributes::LAST_ZOOM]=QString::number(last_zoom);
-      attribs_aux[ParsersAttributes::DEFAULT_SCHEMA]=(default_objs[OBJ_SCHEMA] ? default_objs[OBJ_SCHEMA]->getName(true) : QString());
-      attribs_aux[ParsersAttributes::DEFAULT_OWNER]=(default_objs[OBJ_ROLE] ? default_objs[OBJ_ROLE]->getName(true) : QString());
-      attribs_aux[ParsersAttributes::DEFAULT_TABLESPACE]=(default_objs[OBJ_TABLESPACE] ? default_objs[OBJ_TABLESPACE]->getName(true) : QString());
-      attribs_aux[ParsersAttributes::DEFAULT_COLLATION]=(default_objs[OBJ_COLLATION] ? default_objs[OBJ_COLLATION]->getName(true) : QString());
-    }
+      setRootXMLAttributes(attribs_aux);
     else
     {
       for(auto type : types)
@@ -6453,7 +6550,215 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
   return(def);
 }
 
+void DatabaseModel::setRootXMLAttributes(attribs_map &attribs)
+{
+	attribs[ParsersAttributes::PROTECTED]=(this->is_protected ? ParsersAttributes::_TRUE_ : QString());
+	attribs[ParsersAttributes::LAST_POSITION]=QString("%1,%2").arg(last_pos.x()).arg(last_pos.y());
+	attribs[ParsersAttributes::LAST_ZOOM]=QString::number(last_zoom);
+	attribs[ParsersAttributes::DEFAULT_SCHEMA]=(default_objs[OBJ_SCHEMA] ? default_objs[OBJ_SCHEMA]->getName(true) : QString());
+	attribs[ParsersAttributes::DEFAULT_OWNER]=(default_objs[OBJ_ROLE] ? default_objs[OBJ_ROLE]->getName(true) : QString());
+	attribs[ParsersAttributes::DEFAULT_TABLESPACE]=(default_objs[OBJ_TABLESPACE] ? default_objs[OBJ_TABLESPACE]->getName(true) : QString());
+	attribs[ParsersAttributes::DEFAULT_COLLATION]=(default_objs[OBJ_COLLATION] ? default_objs[OBJ_COLLATION]->getName(true) : QString());
+}
+
+QByteArray DatabaseModel::getStructureSignature(void)
+{
+	QCryptographicHash hash(QCryptographicHash::Md5);
+	ObjectType tab_obj_types[]={ OBJ_COLUMN, OBJ_CONSTRAINT, OBJ_TRIGGER, OBJ_INDEX, OBJ_RULE };
+	vector<BaseObject *> *obj_list=nullptr;
+	Table *table=nullptr;
+	TableObject *tab_obj=nullptr;
+	Relationship *rel=nullptr;
+	BaseRelationship *base_rel=nullptr;
+	unsigned count=0, i=0;
+
+	for(auto object : tables)
+	{
+		table=dynamic_cast<Table *>(object);
+		hash.addData(table->getSignature().toUtf8());
+
+		for(auto obj_type : tab_obj_types)
+		{
+			count=table->getObjectCount(obj_type);
+
+			for(i=0; i < count; i++)
+			{
+				tab_obj=dynamic_cast<TableObject *>(table->getObject(i, obj_type));
+				hash.addData(QString("%1:%2:%3%4%5").arg(obj_type).arg(tab_obj->getName())
+										 .arg(tab_obj->isAddedByLinking()).arg(tab_obj->isAddedByGeneralization()).arg(tab_obj->isAddedByCopy()).toUtf8());
+				hash.addData(getStructureSignature(tab_obj).toUtf8());
+			}
+		}
+	}
+
+	for(auto obj_type : { OBJ_VIEW, OBJ_SEQUENCE, OBJ_RELATIONSHIP, BASE_RELATIONSHIP })
+	{
+		obj_list=getObjectList(obj_type);
+
+		for(auto object : *obj_list)
+		{
+			hash.addData(QString("%1:%2").arg(obj_type).arg(object->getSignature()).toUtf8());
+
+			base_rel=dynamic_cast<BaseRelationship *>(object);
+			if(!base_rel)
+				continue;
+
+			hash.addData(QString("%1:%2:%3:%4%5").arg(base_rel->getRelationshipType())
+									 .arg(base_rel->getTable(BaseRelationship::SRC_TABLE)->getSignature())
+									 .arg(base_rel->getTable(BaseRelationship::DST_TABLE)->getSignature())
+									 .arg(base_rel->isTableMandatory(BaseRelationship::SRC_TABLE))
+									 .arg(base_rel->isTableMandatory(BaseRelationship::DST_TABLE)).toUtf8());
+
+			rel=dynamic_cast<Relationship *>(object);
+			if(!rel)
+				continue;
+
+			//The attributes that control the objects generated by the relationship
+			hash.addData(QString("%1%2:%3:%4:%5:%6:%7:%8").arg(rel->isIdentifier()).arg(rel->isDeferrable())
+									 .arg(~rel->getDeferralType())
+									 .arg(~rel->getActionType(Constraint::DELETE_ACTION))
+									 .arg(~rel->getActionType(Constraint::UPDATE_ACTION))
+									 .arg(rel->getCopyOptions().getCopyMode())
+									 .arg(rel->getCopyOptions().getCopyOptionsIds())
+									 .arg(rel->getTableNameRelNN()).toUtf8());
+
+			for(i=Relationship::SRC_COL_PATTERN; i <= Relationship::PK_COL_PATTERN; i++)
+				hash.addData(rel->getNamePattern(i).toUtf8());
+
+			for(auto col_id : rel->getSpecialPrimaryKeyCols())
+				hash.addData(QString::number(col_id).toUtf8());
+
+			for(auto attrib : rel->getAttributes())
+				hash.addData(QString("%1:%2").arg(attrib->getName()).arg(getStructureSignature(attrib)).toUtf8());
+
+			for(auto constr : rel->getConstraints())
+				hash.addData(QString("%1:%2").arg(constr->getName()).arg(getStructureSignature(constr)).toUtf8());
+		}
+	}
+
+	for(auto object : permissions)
+		hash.addData(dynamic_cast<Permission *>(object)->getObject()->getSignature().toUtf8());
+
+	return(hash.result());
+}
+
+QString DatabaseModel::getStructureSignature(TableObject *tab_obj)
+{
+	Column *column=dynamic_cast<Column *>(tab_obj);
+	Constraint *constr=dynamic_cast<Constraint *>(tab_obj);
+	QStringList attribs;
+
+	if(column)
+	{
+		attribs.push_back(*column->getType());
+		attribs.push_back(QString::number(column->isNotNull()));
+		attribs.push_back(column->getDefaultValue());
+		attribs.push_back(column->getSequence() ? column->getSequence()->getSignature() : QString());
+		attribs.push_back(column->getParentRelationship() ? column->getParentRelationship()->getName() : QString());
+	}
+	else if(constr)
+	{
+		attribs.push_back(~constr->getConstraintType());
+		attribs.push_back(constr->getReferencedTable() ? constr->getReferencedTable()->getSignature() : QString());
+		attribs.push_back(~constr->getActionType(Constraint::DELETE_ACTION));
+		attribs.push_back(~constr->getActionType(Constraint::UPDATE_ACTION));
+		attribs.push_back(~constr->getMatchType());
+		attribs.push_back(~constr->getDeferralType());
+		attribs.push_back(QString::number(constr->isDeferrable()));
+		attribs.push_back(constr->getExpression());
+
+		for(unsigned col_type=Constraint::SOURCE_COLS; col_type <= Constraint::REFERENCED_COLS; col_type++)
+		{
+			for(unsigned i=0; i < constr->getColumnCount(col_type); i++)
+				attribs.push_back(constr->getColumn(i, col_type)->getName());
+		}
+	}
+
+	return(attribs.join(QChar(':')));
+}
+
+QString DatabaseModel::getRootXMLDefinition(void)
+{
+	attribs_map attribs;
+
+	try
+	{
+		attribs[ParsersAttributes::OBJECTS]=QString();
+		attribs[ParsersAttributes::PERMISSION]=QString();
+		attribs[ParsersAttributes::MODEL_AUTHOR]=author;
+		attribs[ParsersAttributes::PGMODELER_VERSION]=GlobalAttributes::PGMODELER_VERSION;
+		setRootXMLAttributes(attribs);
+
+		return(schparser.getCodeDefinition(ParsersAttributes::DB_MODEL, attribs, SchemaParser::XML_DEFINITION));
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+QString DatabaseModel::getObjectXMLDefinition(BaseObject *object)
+{
+	ObjectType obj_type;
+
+	if(!object)
+		throw Exception(ERR_OPR_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	obj_type=object->getObjectType();
+
+	if(object==this)
+		return(this->__getCodeDefinition(SchemaParser::XML_DEFINITION));
+	else if(obj_type==OBJ_PERMISSION)
+		return(dynamic_cast<Permission *>(object)->getCodeDefinition(SchemaParser::XML_DEFINITION));
+	else if(obj_type==OBJ_CONSTRAINT)
+		return(dynamic_cast<Constraint *>(object)->getCodeDefinition(SchemaParser::XML_DEFINITION, true));
+	//System objects doesn't have the XML generated (the only exception is for public schema)
+	else if(object->isSystemObject() &&
+					(obj_type!=OBJ_SCHEMA || object->getName()!=QString("public")))
+		return(QString());
+	else
+		return(object->getCodeDefinition(SchemaParser::XML_DEFINITION));
+}
+
+QString DatabaseModel::getDisabledSQLDefinition(BaseObject *object)
+{
+	QString code_def=(object==this ? this->__getCodeDefinition(SchemaParser::SQL_DEFINITION) :
+																		object->getCodeDefinition(SchemaParser::SQL_DEFINITION)), buf;
+	QTextStream ts(&code_def);
+
+	//The code is already commented when the object has the SQL disabled
+	if(object->isSQLDisabled())
+		return(code_def);
+
+	//Inserts a comment start token on each line (as done by BaseObject::getCodeDefinition() for disabled objects)
+	while(!ts.atEnd())
+		buf+=QString("-- %1\n").arg(ts.readLine());
+
+	return(buf);
+}
+
 map<unsigned, BaseObject *> DatabaseModel::getCreationOrder(unsigned def_type, bool incl_relnn_objs)
+{
+	QMutexLocker locker(&creation_orders_mutex);
+	CreationOrder &order=creation_orders[pair<unsigned, bool>(def_type, def_type==SchemaParser::SQL_DEFINITION && incl_relnn_objs)];
+
+	/* The order depends only on the objects inserted on the model, their attributes and ids. Any change on them
+		 increments the global modification id, the global object id or the model's change id */
+	if(order.objects.empty() ||
+		 order.mod_id!=BaseObject::getGlobalModificationId() ||
+		 order.global_id!=BaseObject::getGlobalId() ||
+		 order.change_id!=change_id)
+	{
+		order.objects=__getCreationOrder(def_type, incl_relnn_objs);
+		order.mod_id=BaseObject::getGlobalModificationId();
+		order.global_id=BaseObject::getGlobalId();
+		order.change_id=change_id;
+	}
+
+	return(order.objects);
+}
+
+map<unsigned, BaseObject *> DatabaseModel::__getCreationOrder(unsigned def_type, bool incl_relnn_objs)
 {
   BaseObject *object=nullptr;
   vector<BaseObject *> fkeys;
@@ -7136,26 +7441,22 @@ void DatabaseModel::getObjectReferences(BaseObject *object, vector<BaseObject *>
 
 	if(object)
 	{
-		vector<BaseObject *>::iterator itr_perm, itr_perm_end;
 		ObjectType obj_type=object->getObjectType();
 		bool refer=false;
-		Permission *perm=nullptr;
 
 		if(!exclude_perms)
 		{
 			//Get the permissions thata references the object
-			itr_perm=permissions.begin();
-			itr_perm_end=permissions.end();
-
-			while(itr_perm!=itr_perm_end && (!exclusion_mode || (exclusion_mode && !refer)))
+			if(obj_permissions.count(object))
 			{
-				perm=dynamic_cast<Permission *>(*itr_perm);
-				if(perm->getObject()==object)
-				{
-					refer=true;
-					refs.push_back(perm);
-				}
-				itr_perm++;
+				vector<Permission *> &perms=obj_permissions[object];
+
+				refer=true;
+
+				if(exclusion_mode)
+					refs.push_back(perms.front());
+				else
+					refs.insert(refs.end(), perms.begin(), perms.end());
 			}
 		}
 
@@ -7475,28 +7776,26 @@ void DatabaseModel::getObjectReferences(BaseObject *object, vector<BaseObject *>
 
 		if(obj_type==OBJ_SCHEMA && (!exclusion_mode || (exclusion_mode && !refer)))
 		{
-			vector<BaseObject *> *obj_list=nullptr;
-			vector<BaseObject *>::iterator itr, itr_end;
+			vector<BaseObject *> obj_list;
 			ObjectType obj_types[11]={OBJ_FUNCTION, OBJ_TABLE, OBJ_VIEW,
 																OBJ_DOMAIN, OBJ_AGGREGATE, OBJ_OPERATOR,
 																OBJ_SEQUENCE, OBJ_CONVERSION,
 																OBJ_TYPE, OBJ_OPFAMILY, OBJ_OPCLASS};
 			unsigned i;
 
+			//Only the objects of the schema are retrieved (see getObjects())
 			for(i=0; i < 11 && (!exclusion_mode || (exclusion_mode && !refer)); i++)
 			{
-				obj_list=getObjectList(obj_types[i]);
-				itr=obj_list->begin();
-				itr_end=obj_list->end();
+				obj_list=getObjects(obj_types[i], object);
 
-				while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
+				if(!obj_list.empty())
 				{
-					if((*itr)->getSchema()==object)
-					{
-						refer=true;
-						refs.push_back(*itr);
-					}
-					itr++;
+					refer=true;
+
+					if(exclusion_mode)
+						refs.push_back(obj_list.front());
+					else
+						refs.insert(refs.end(), obj_list.begin(), obj_list.end());
 				}
 			}
 		}
@@ -8320,10 +8619,11 @@ void DatabaseModel::setCodesInvalidated(vector<ObjectType> types)
 	{
 		ObjectType tab_obj_types[]={OBJ_COLUMN, OBJ_CONSTRAINT,
 																OBJ_TRIGGER, OBJ_RULE, OBJ_INDEX};
-		for(unsigned i=0; i < 5; i++)
-			sel_types.erase(std::find(sel_types.begin(), sel_types.end(), tab_obj_types[i]));
-
 		sel_types=types;
+
+		//Table objects are invalidated together with their parent tables
+		for(unsigned i=0; i < 5; i++)
+			sel_types.erase(std::remove(sel_types.begin(), sel_types.end(), tab_obj_types[i]), sel_types.end());
 	}
 
 	while(!sel_types.empty())
@@ -8490,7 +8790,21 @@ void DatabaseModel::createSystemObjects(bool create_public)
   setDefaultObject(getObject(QString("public"), OBJ_SCHEMA), OBJ_SCHEMA);
 }
 
-vector<BaseObject *> DatabaseModel::findObjects(const QString &pattern, vector<ObjectType> types, bool format_obj_names, bool case_sensitive, bool is_regexp, bool exact_match)
+void DatabaseModel::removeFromSearchIndex(BaseObject *object)
+{
+	BaseTable *table=dynamic_cast<BaseTable *>(object);
+
+	search_idx.removeObject(object);
+
+	//The children of tables and views are indexed too so they are dropped along with their parent
+	if(table)
+	{
+		for(auto child : table->getObjects())
+			search_idx.removeObject(child);
+	}
+}
+
+vector<BaseObject *> DatabaseModel::findObjects(const QString &pattern, vector<ObjectType> types, bool format_obj_names, bool case_sensitive, bool is_regexp, bool exact_match, bool search_defs)
 {
 	vector<BaseObject *> list, objs;
   vector<BaseObject *>::iterator end;
@@ -8498,19 +8812,6 @@ vector<BaseObject *> DatabaseModel::findObjects(const QString &pattern, vector<O
 	vector<BaseObject *> tables;
 	bool inc_tabs=false, inc_views=false;
 	ObjectType obj_type;
-	QRegExp regexp;
-	QString obj_name;
-
-	//Configuring the regex style
-	regexp.setPattern(pattern);
-	regexp.setCaseSensitivity(case_sensitive ?  Qt::CaseSensitive :  Qt::CaseInsensitive);
-
-	if(is_regexp)
-		regexp.setPatternSyntax(QRegExp::RegExp2);
-	else if(exact_match)
-		regexp.setPatternSyntax(QRegExp::FixedString);
-	else
-		regexp.setPatternSyntax(QRegExp::Wildcard);
 
 	//If there is some table object types on the type list, gather tables and views
 	while(itr_tp!=types.end() && (!inc_views || !inc_tabs))
@@ -8565,30 +8866,8 @@ vector<BaseObject *> DatabaseModel::findObjects(const QString &pattern, vector<O
 		}
 	}
 
-	//Try to find  the objects on the configured list
-	while(!objs.empty())
-	{
-		//Quotes are removed from the name by default
-		if(format_obj_names)
-		{
-      if(TableObject::isTableObject(objs.back()->getObjectType()))
-        obj_name=dynamic_cast<TableObject *>(objs.back())->getParentTable()->getName(true);
-
-			obj_name+=objs.back()->getName(true, true);
-			obj_name.remove('"');
-		}
-		else
-			obj_name=objs.back()->getName();
-
-		//Try to match the name on the configured regexp
-		if((exact_match && pattern==obj_name) ||
-			 (exact_match && regexp.exactMatch(obj_name)) ||
-			 (!exact_match && regexp.indexIn(obj_name) >= 0))
-			list.push_back(objs.back());
-
-		objs.pop_back();
-		obj_name.clear();
-	}
+	//The index only matches the candidate objects selected through the pattern's trigrams
+	list=search_idx.findObjects(objs, pattern, format_obj_names, search_defs, case_sensitive, is_regexp, exact_match);
 
   //Removing the duplicate items on the list
   std::sort(list.begin(), list.end());
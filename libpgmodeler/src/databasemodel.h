@@ -30,6 +30,7 @@ Additionally, this class, saves, loads and generates the XML/SQL definition of a
 #include <QFile>
 #include <QObject>
 #include <QStringList>
+#include <QMutex>
 #include "baseobject.h"
 #include "table.h"
 #include "function.h"
@@ -53,6 +54,8 @@ Additionally, this class, saves, loads and generates the XML/SQL definition of a
 #include "extension.h"
 #include "tag.h"
 #include "eventtrigger.h"
+#include "objectssearchindex.h"
+#include "modelcache.h"
 #include <algorithm>
 #include <locale.h>
 
@@ -64,6 +67,37 @@ class DatabaseModel:  public QObject, public BaseObject {
 
 		XMLParser xmlparser;
 
+		//! \brief Index used to speed up the objects searching (see findObjects())
+		ObjectsSearchIndex search_idx;
+
+		/*! \brief Permissions indexed by the object they are applied to. This index is used to speed up
+		the duplicated permissions checking and the retrieval/removal of the permissions of an object */
+		map<BaseObject *, vector<Permission *>> obj_permissions;
+
+		/*! \brief Objects that accept schemas indexed by their schemas and types. This index is used to
+		retrieve the objects of a schema without scanning the objects of the whole model */
+		map<BaseObject *, map<ObjectType, vector<BaseObject *>>> schema_objs;
+
+		//! \brief Stores a creation order computed by getCreationOrder() and the state of the objects when it was computed
+		struct CreationOrder {
+			//! \brief Global modification id (see BaseObject::getGlobalModificationId()) and model's change id
+			unsigned long long mod_id, change_id;
+
+			//! \brief Global object id when the order was computed (see BaseObject::getGlobalId())
+			unsigned global_id;
+
+			map<unsigned, BaseObject *> objects;
+		};
+
+		//! \brief Creation orders already computed indexed by the definition type and the incl_relnn_objs flag
+		map<pair<unsigned, bool>, CreationOrder> creation_orders;
+
+		//! \brief Mutex that controls the access to the creation orders (the code can be generated in threads)
+		QMutex creation_orders_mutex;
+
+		//! \brief Incremented each time an object or permission is inserted on or removed from the model
+		std::atomic<unsigned long long> change_id;
+
 		//! \brief Database encoding
 		EncodingType encoding;
 
@@ -143,6 +177,26 @@ class DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Recreates the special object from the passed xml code buffer
 		void createSpecialObject(const QString &xml_def, unsigned obj_id=0);
 
+		/*! \brief Returns the permission on the model that is equivalent to the specified one: the permission itself or
+		one applied to the same object, of the same kind (GRANT/REVOKE) and referencing at least one common role */
+		Permission *getDuplicatedPermission(Permission *perm);
+
+		/*! \brief Returns the SQL code of the object (database or tablespace) commented out as if its SQL was disabled.
+		The SQL disabled state isn't toggled since that would invalidate the object's code and the cached creation orders */
+		QString getDisabledSQLDefinition(BaseObject *object);
+
+		//! \brief Computes the creation order of the objects (see getCreationOrder())
+		map<unsigned, BaseObject *> __getCreationOrder(unsigned def_type, bool incl_relnn_objs);
+
+		//! \brief Inserts the object on the schema index if it accepts a schema
+		void addSchemaIndexEntry(BaseObject *object, BaseObject *schema);
+
+		//! \brief Removes the object from the schema index returning true if it was indexed under the specified schema
+		bool removeSchemaIndexEntry(BaseObject *object, BaseObject *schema);
+
+		//! \brief Moves the object to its current schema on the schema index (only if the object is already indexed)
+		void updateSchemaIndex(BaseObject *object, BaseObject *prev_schema);
+
 		//! \brief Removes an user defined type (domain or type)
 		void removeUserType(BaseObject *object, int obj_idx);
 
@@ -156,6 +210,17 @@ class DatabaseModel:  public QObject, public BaseObject {
 		//! brief Returns extra error info when loading database models
 		QString getErrorExtraInfo(void);
 
+		//! \brief Configures the attributes of the root element (dbmodel) used by the XML definition of the model
+		void setRootXMLAttributes(attribs_map &attribs);
+
+		/*! \brief Returns a hash of the structure of the tables, views, sequences, relationships and permissions
+		(names and order of the objects plus the attributes handled by the relationships, like columns types, constraints
+		columns and actions, and the relationships settings). Used to detect if the relationships revalidation changed the model */
+		QByteArray getStructureSignature(void);
+
+		//! \brief Returns the attributes of the column or constraint that are part of the model structure signature
+		QString getStructureSignature(TableObject *tab_obj);
+
 	public:
 		DatabaseModel(void);
 		~DatabaseModel(void);
@@ -241,6 +306,9 @@ class DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Returns the object count for all object types
 		unsigned getObjectCount(void);
 
+		//! \brief Returns the object count for each object type including the children of tables and views
+		map<ObjectType, unsigned> getObjectCountByType(void);
+
 		//! \brief Retuns the specified localization value
 		QString getLocalization(unsigned localiz_id);
 
@@ -278,10 +346,19 @@ class DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Returns the code definition only for the database (excluding the definition of the other objects)
 		QString __getCodeDefinition(unsigned def_type);
 
+		/*! \brief Returns the XML code of the root element (dbmodel) without the objects definitions. The returned
+		code contains the XML declaration, the opening and the closing tags of the root element */
+		QString getRootXMLDefinition(void);
+
+		/*! \brief Returns the XML code of the object exactly as it is written in the model file by getCodeDefinition().
+		System objects which aren't saved in the model file (except the public schema) have an empty definition */
+		QString getObjectXMLDefinition(BaseObject *object);
+
     /*! brief Returns the creation order of objects in each definition type (SQL or XML).
         The parameter incl_relnn_objs when 'true' includes the generated objects (table and constraint)
         of the many-to-many relationships instead of the relationships themselves. The incl_relnn_objs is
-        is accepted only when the creation order for SQL code is being generated, for XML, it'll simply ignored. */
+        is accepted only when the creation order for SQL code is being generated, for XML, it'll simply ignored.
+        The computed order is reused until some object of the model is created, modified, inserted or removed. */
     map<unsigned, BaseObject *> getCreationOrder(unsigned def_type, bool incl_relnn_objs=false);
 
 		void addRelationship(BaseRelationship *rel, int obj_idx=-1);
@@ -506,9 +583,14 @@ class DatabaseModel:  public QObject, public BaseObject {
     void createSystemObjects(bool create_public);
 
 		/*! \brief Returns a list of object searching them using the specified pattern. The search can be delimited by filtering the object's types.
-		The additional bool params are: case sensitive name search, name pattern is a regexp, exact match for names. */
+		The additional bool params are: case sensitive name search, name pattern is a regexp, exact match for names and search the pattern
+		on comments and source code (functions bodies, views definitions, expressions) too. */
 		vector<BaseObject *> findObjects(const QString &pattern, vector<ObjectType> types, bool format_obj_names,
-																		 bool case_sensitive, bool is_regexp, bool exact_match);
+																		 bool case_sensitive, bool is_regexp, bool exact_match, bool search_defs=false);
+
+		/*! \brief Drops the object from the index used by findObjects(). Tables and views call this method when one of
+		their children is removed since the model isn't notified about that kind of removal */
+		void removeFromSearchIndex(BaseObject *object);
 
     void setLastPosition(const QPoint &pnt);
     QPoint getLastPosition(void);
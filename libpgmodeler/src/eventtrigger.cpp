@@ -105,6 +105,7 @@ QString EventTrigger::getCodeDefinition(unsigned def_type)
 {
 	QString code_def=getCachedCode(def_type, false);
 	if(!code_def.isEmpty()) return(code_def);
+	CodeGenerationGuard gen_guard(this);
 
 	attributes[ParsersAttributes::EVENT]=~event;
 
@@ -417,6 +417,7 @@ void Function::removeReturnedTableColumn(unsigned column_idx)
 
 QString Function::getSignature(bool)
 {
+	registerCodeDependency();
 	return(signature);
 }
 
@@ -454,6 +455,7 @@ QString Function::getCodeDefinition(unsigned def_type, bool reduced_form)
 {
 	QString code_def=getCachedCode(def_type, reduced_form);
 	if(!code_def.isEmpty()) return(code_def);
+	CodeGenerationGuard gen_guard(this);
 
 	setParametersAttribute(def_type);
 
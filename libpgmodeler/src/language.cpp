@@ -114,6 +114,7 @@ QString Language::getCodeDefinition(unsigned def_type, bool reduced_form)
 {
 	QString code_def=getCachedCode(def_type, reduced_form);
 	if(!code_def.isEmpty()) return(code_def);
+	CodeGenerationGuard gen_guard(this);
 
 	unsigned i;
 	QString attribs_func[3]={ParsersAttributes::VALIDATOR_FUNC,
@@ -0,0 +1,123 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2015 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "modelcache.h"
+#include "globalattributes.h"
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+
+const QString ModelCache::CACHE_EXT=QString(".cache");
+
+QString ModelCache::getCacheFilename(const QByteArray &hash)
+{
+	return(GlobalAttributes::TEMPORARY_DIR + GlobalAttributes::DIR_SEPARATOR + QString(hash.toHex()) + CACHE_EXT);
+}
+
+QByteArray ModelCache::getFileHash(const QString &filename)
+{
+	QFile input(filename);
+	QCryptographicHash hash(QCryptographicHash::Sha1);
+
+	input.open(QFile::ReadOnly);
+
+	if(!input.isOpen() || !hash.addData(&input))
+		return(QByteArray());
+
+	input.close();
+	return(hash.result());
+}
+
+unsigned ModelCache::readCache(const QByteArray &hash)
+{
+	QFile input;
+	QDataStream stream;
+	quint32 magic=0, version=0, flags=0;
+	QString pgmodeler_ver;
+	QByteArray stored_hash;
+
+	if(hash.isEmpty())
+		return(0);
+
+	input.setFileName(getCacheFilename(hash));
+	input.open(QFile::ReadOnly);
+
+	if(!input.isOpen())
+		return(0);
+
+	stream.setDevice(&input);
+	stream.setVersion(QDataStream::Qt_5_0);
+	stream >> magic >> version;
+
+	//Discards caches written in a different format
+	if(magic!=CACHE_MAGIC || version!=CACHE_VERSION)
+		return(0);
+
+	stream >> pgmodeler_ver >> stored_hash >> flags;
+	input.close();
+
+	//The cache is valid only for the same file contents loaded by the same pgModeler version
+	if(stream.status()!=QDataStream::Ok ||
+		 pgmodeler_ver!=GlobalAttributes::PGMODELER_VERSION || stored_hash!=hash)
+		return(0);
+
+	return(flags);
+}
+
+void ModelCache::writeCache(const QByteArray &hash, unsigned flags)
+{
+	QFile output;
+	QDataStream stream;
+
+	if(hash.isEmpty())
+		return;
+
+	output.setFileName(getCacheFilename(hash));
+	output.open(QFile::WriteOnly | QFile::Truncate);
+
+	if(!output.isOpen())
+		return;
+
+	stream.setDevice(&output);
+	stream.setVersion(QDataStream::Qt_5_0);
+	stream << static_cast<quint32>(CACHE_MAGIC) << static_cast<quint32>(CACHE_VERSION)
+				 << GlobalAttributes::PGMODELER_VERSION << hash << static_cast<quint32>(flags);
+	output.close();
+
+	//Removes the incomplete file so it isn't read as a valid cache later
+	if(stream.status()!=QDataStream::Ok)
+		output.remove();
+
+	removeOldCaches();
+}
+
+void ModelCache::removeOldCaches(void)
+{
+	QDir dir(GlobalAttributes::TEMPORARY_DIR);
+	QStringList files;
+
+	//Files are listed from the newest to the oldest one
+	files=dir.entryList({ QString("*") + CACHE_EXT }, QDir::Files, QDir::Time);
+
+	while(static_cast<unsigned>(files.size()) > MAX_CACHE_FILES)
+	{
+		dir.remove(files.back());
+		files.pop_back();
+	}
+}
@@ -0,0 +1,71 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2015 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgmodeler
+\class ModelCache
+\brief Implements a small versioned binary cache that stores, for each model file contents (identified
+by its SHA-1 hash), which of the expensive loading steps were proven unnecessary in a previous loading.
+The cache files are stored on the temporary dir and are discarded on any mismatch (format, pgModeler version or hash).
+\note Since the model loading is deterministic for the same file contents and pgModeler version, a step
+that didn't change anything in a previous loading can be safely skipped (see DatabaseModel::loadModel()).
+*/
+
+#ifndef MODEL_CACHE_H
+#define MODEL_CACHE_H
+
+#include <QString>
+#include <QByteArray>
+
+class ModelCache {
+	private:
+		//! \brief Identification and version of the cache file format
+		static const unsigned CACHE_MAGIC=0x50474d43,
+		CACHE_VERSION=2,
+
+		//! \brief Maximum amount of cache files kept on the temporary dir
+		MAX_CACHE_FILES=30;
+
+		//! \brief Extension of the cache files
+		static const QString CACHE_EXT;
+
+		//! \brief Returns the path to the cache file related to the hash
+		static QString getCacheFilename(const QByteArray &hash);
+
+		//! \brief Removes the oldest cache files when the limit of files is exceeded
+		static void removeOldCaches(void);
+
+	public:
+		//! \brief The model file was already successfully validated against the DTD
+		static const unsigned VALIDATED_DTD=1,
+
+		/*! \brief The relationships revalidation done at the end of the loading produced a model with
+		the same structure as the one loaded from the file (see DatabaseModel::getStructureSignature()) */
+		STABLE_RELATIONSHIPS=2;
+
+		//! \brief Returns the SHA-1 hash of the file contents (an empty hash is returned if the file can't be read)
+		static QByteArray getFileHash(const QString &filename);
+
+		//! \brief Returns the flags stored for the hash or zero when there is no valid cache for it
+		static unsigned readCache(const QByteArray &hash);
+
+		//! \brief Stores the flags for the hash. Errors while writing the cache are ignored since it's only an optimization
+		static void writeCache(const QByteArray &hash, unsigned flags);
+};
+
+#endif
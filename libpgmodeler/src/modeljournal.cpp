@@ -0,0 +1,377 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2015 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "modeljournal.h"
+#include <QDateTime>
+#include <QFileInfo>
+#include <QRegExp>
+#include <QSaveFile>
+
+const QString ModelJournal::SNAPSHOT_MARKER=QString("<!--snapshot:%1-->\n");
+const QString ModelJournal::SEGMENT_MARKER=QString("<!--segment:%1:%2:%3-->\n");
+const QString ModelJournal::JOURNAL_EXT=QString(".journal");
+
+ModelJournal::ModelJournal(DatabaseModel *model, const QString &filename)
+{
+	if(!model)
+		throw Exception(ERR_ASG_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	this->model=model;
+	this->filename=filename;
+	reset();
+}
+
+void ModelJournal::reset(void)
+{
+	snapshot_id.clear();
+	root_def.clear();
+	db_def.clear();
+	saved_ids.clear();
+	journal_count=0;
+	snapshot_size=0;
+}
+
+QString ModelJournal::getJournalFilename(const QString &filename)
+{
+	return(filename + JOURNAL_EXT);
+}
+
+ModelJournal::SegmentKey ModelJournal::getSegmentKey(BaseObject *object)
+{
+	ObjectType obj_type=object->getObjectType();
+	unsigned section=REGULAR_SECTION;
+
+	/* The foreign keys, fk relationships and permissions are written at the end of the model file
+	in this order (see DatabaseModel::getCreationOrder()) */
+	if(obj_type==OBJ_PERMISSION)
+		section=PERMISSION_SECTION;
+	else if(obj_type==OBJ_CONSTRAINT &&
+					dynamic_cast<Constraint *>(object)->getConstraintType()==ConstraintType::foreign_key)
+		section=FK_SECTION;
+	else if(obj_type==BASE_RELATIONSHIP &&
+					dynamic_cast<BaseRelationship *>(object)->getRelationshipType()==BaseRelationship::RELATIONSHIP_FK)
+		section=FK_REL_SECTION;
+
+	return(SegmentKey(section, object->getObjectId()));
+}
+
+map<ModelJournal::SegmentKey, BaseObject *> ModelJournal::getObjects(void)
+{
+	map<unsigned, BaseObject *> creation_order=model->getCreationOrder(SchemaParser::XML_DEFINITION);
+	map<SegmentKey, BaseObject *> objects;
+
+	for(auto &itr : creation_order)
+		objects[getSegmentKey(itr.second)]=itr.second;
+
+	return(objects);
+}
+
+void ModelJournal::saveModel(void)
+{
+	try
+	{
+		QFileInfo jnl_info(getJournalFilename(filename));
+
+		if(snapshot_id.isEmpty() || !QFileInfo(filename).exists() ||
+			 journal_count >= SNAPSHOT_INTERVAL ||
+			 (jnl_info.exists() && jnl_info.size() > snapshot_size))
+			writeSnapshot();
+		else
+			appendJournal();
+	}
+	catch(Exception &e)
+	{
+		//Forces a full snapshot on the next saving since the files can be in an inconsistent state
+		reset();
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void ModelJournal::writeSnapshot(void)
+{
+	map<SegmentKey, BaseObject *> objects=getObjects();
+	map<SegmentKey, QString> segments;
+	map<SegmentKey, unsigned long long> mod_ids;
+	QString new_root_def=model->getRootXMLDefinition(),
+			new_snapshot_id=QString::number(QDateTime::currentMSecsSinceEpoch());
+
+	for(auto &itr : objects)
+	{
+		mod_ids[itr.first]=itr.second->getModificationId();
+		segments[itr.first]=model->getObjectXMLDefinition(itr.second);
+
+		if(itr.second==model)
+			db_def=segments[itr.first];
+	}
+
+	snapshot_size=writeSnapshot(filename, new_root_def, new_snapshot_id, segments);
+
+	//The previous journal is useless since it refers to the older snapshot
+	QFile::remove(getJournalFilename(filename));
+
+	saved_ids.swap(mod_ids);
+	root_def=new_root_def;
+	snapshot_id=new_snapshot_id;
+	journal_count=0;
+}
+
+void ModelJournal::appendJournal(void)
+{
+	map<SegmentKey, BaseObject *> objects=getObjects();
+	map<SegmentKey, unsigned long long>::iterator id_itr;
+	QString new_root_def=model->getRootXMLDefinition(), code,
+			key_fmt=QString("%1:%2");
+	QByteArray buf;
+	QFile output(getJournalFilename(filename));
+
+	if(new_root_def!=root_def)
+	{
+		buf.append(QString("@@root %1\n").arg(new_root_def.length()));
+		buf.append(new_root_def);
+	}
+
+	for(auto &itr : objects)
+	{
+		id_itr=saved_ids.find(itr.first);
+
+		/* The database attributes don't invalidate its code so it's always generated and
+		compared to the stored one. The other objects are written only when modified */
+		if(itr.second==model)
+		{
+			code=model->getObjectXMLDefinition(model);
+
+			if(code==db_def)
+				continue;
+
+			db_def=code;
+		}
+		else if(id_itr!=saved_ids.end() && id_itr->second==itr.second->getModificationId())
+			continue;
+		else
+			code=model->getObjectXMLDefinition(itr.second);
+
+		buf.append(QString("@@set %1 %2\n").arg(key_fmt.arg(itr.first.first).arg(itr.first.second)).arg(code.length()));
+		buf.append(code);
+	}
+
+	//Registering the objects that were removed from the model since the last saving
+	for(auto &itr : saved_ids)
+	{
+		if(objects.count(itr.first)==0)
+			buf.append(QString("@@remove %1\n").arg(key_fmt.arg(itr.first.first).arg(itr.first.second)));
+	}
+
+	//Nothing changed since the last saving
+	if(buf.isEmpty())
+		return;
+
+	buf.append(QString("@@commit\n"));
+	output.open(QFile::WriteOnly | QFile::Append);
+
+	if(!output.isOpen())
+		throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_WRITTEN).arg(output.fileName()),
+										ERR_FILE_DIR_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	//A new journal always starts identifying the snapshot it refers to
+	if(output.size()==0)
+		buf.prepend(QString("@@snapshot %1\n").arg(snapshot_id).toUtf8());
+
+	if(output.write(buf.data(), buf.size())!=buf.size())
+	{
+		output.close();
+		throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_WRITTEN).arg(output.fileName()),
+										ERR_FILE_DIR_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	output.close();
+
+	for(auto &itr : objects)
+		saved_ids[itr.first]=itr.second->getModificationId();
+
+	for(id_itr=saved_ids.begin(); id_itr!=saved_ids.end();)
+	{
+		if(objects.count(id_itr->first)==0)
+			id_itr=saved_ids.erase(id_itr);
+		else
+			id_itr++;
+	}
+
+	root_def=new_root_def;
+	journal_count++;
+}
+
+qint64 ModelJournal::writeSnapshot(const QString &filename, const QString &root_def, const QString &snapshot_id, map<SegmentKey, QString> &segments)
+{
+	QSaveFile output(filename);
+	QByteArray buf;
+	int end_pos=root_def.lastIndexOf(QString("</dbmodel>"));
+
+	buf.append(root_def.left(end_pos));
+	buf.append(SNAPSHOT_MARKER.arg(snapshot_id));
+
+	for(auto &itr : segments)
+	{
+		//Objects without XML code (e.g. system objects) are not written
+		if(itr.second.isEmpty())
+			continue;
+
+		buf.append(SEGMENT_MARKER.arg(itr.first.first).arg(itr.first.second).arg(itr.second.length()));
+		buf.append(itr.second);
+	}
+
+	buf.append(root_def.mid(end_pos));
+
+	/* The snapshot is written on an auxiliary file which atomically replaces the current one
+	only when committed after a successful writing, this way the previous snapshot is never
+	left truncated or removed. On failure the auxiliary file is discarded by QSaveFile */
+	output.open(QFile::WriteOnly);
+
+	if(!output.isOpen() || output.write(buf.data(), buf.size())!=buf.size() || !output.commit())
+	{
+		output.cancelWriting();
+		throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_WRITTEN).arg(filename),
+										ERR_FILE_DIR_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	return(buf.size());
+}
+
+QString ModelJournal::readFile(const QString &filename)
+{
+	QFile input(filename);
+	QString buffer;
+
+	input.open(QFile::ReadOnly);
+
+	if(!input.isOpen())
+		throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_ACCESSED).arg(filename),
+										ERR_FILE_DIR_NOT_ACCESSED,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	buffer=QString::fromUtf8(input.readAll());
+	input.close();
+
+	return(buffer);
+}
+
+bool ModelJournal::parseSnapshot(const QString &buffer, QString &root_def, QString &snapshot_id, map<SegmentKey, QString> &segments)
+{
+	QRegExp snapshot_regexp(QString("<!--snapshot:(\\d+)-->\\n")),
+			segment_regexp(QString("^<!--segment:(\\d+):(\\d+):(\\d+)-->\\n"));
+	int pos=snapshot_regexp.indexIn(buffer),
+			end_pos=buffer.lastIndexOf(QString("</dbmodel>")), len=0;
+
+	//The file was not written by a journal (e.g. it was saved by an older version)
+	if(pos < 0 || end_pos < pos)
+		return(false);
+
+	snapshot_id=snapshot_regexp.cap(1);
+	root_def=buffer.left(pos) + buffer.mid(end_pos);
+	pos+=snapshot_regexp.matchedLength();
+
+	while(pos < end_pos &&
+				segment_regexp.indexIn(buffer, pos, QRegExp::CaretAtOffset)==pos)
+	{
+		pos+=segment_regexp.matchedLength();
+		len=segment_regexp.cap(3).toInt();
+		segments[SegmentKey(segment_regexp.cap(1).toUInt(), segment_regexp.cap(2).toUInt())]=buffer.mid(pos, len);
+		pos+=len;
+	}
+
+	return(true);
+}
+
+bool ModelJournal::parseJournal(const QString &buffer, const QString &snapshot_id, QString &root_def, map<SegmentKey, QString> &segments)
+{
+	QRegExp record_regexp(QString("^@@(snapshot|root|set|remove|commit)(?: (\\d+):(\\d+))?(?: (\\d+))?\\n"));
+	map<SegmentKey, QString> pend_sets;
+	vector<SegmentKey> pend_removes;
+	QString pend_root_def, record;
+	SegmentKey key;
+	int pos=0, len=0;
+	bool applied=false;
+
+	//The journal must start referencing the same snapshot stored on the model file
+	if(record_regexp.indexIn(buffer, 0, QRegExp::CaretAtOffset)!=0 ||
+		 record_regexp.cap(1)!=QString("snapshot") || record_regexp.cap(4)!=snapshot_id)
+		return(false);
+
+	pos=record_regexp.matchedLength();
+
+	while(record_regexp.indexIn(buffer, pos, QRegExp::CaretAtOffset)==pos)
+	{
+		pos+=record_regexp.matchedLength();
+		record=record_regexp.cap(1);
+		key=SegmentKey(record_regexp.cap(2).toUInt(), record_regexp.cap(3).toUInt());
+		len=record_regexp.cap(4).toInt();
+
+		//Incomplete record (the writing was interrupted)
+		if((record==QString("root") || record==QString("set")) && pos + len > buffer.length())
+			break;
+
+		if(record==QString("root"))
+			pend_root_def=buffer.mid(pos, len);
+		else if(record==QString("set"))
+			pend_sets[key]=buffer.mid(pos, len);
+		else if(record==QString("remove"))
+			pend_removes.push_back(key);
+		else if(record==QString("commit"))
+		{
+			if(!pend_root_def.isEmpty())
+				root_def=pend_root_def;
+
+			for(auto &itr : pend_sets)
+				segments[itr.first]=itr.second;
+
+			for(auto &rem_key : pend_removes)
+				segments.erase(rem_key);
+
+			pend_root_def.clear();
+			pend_sets.clear();
+			pend_removes.clear();
+			applied=true;
+		}
+
+		if(record==QString("root") || record==QString("set"))
+			pos+=len;
+	}
+
+	return(applied);
+}
+
+void ModelJournal::replayJournal(const QString &filename)
+{
+	QString jnl_filename=getJournalFilename(filename),
+			root_def, snapshot_id;
+	map<SegmentKey, QString> segments;
+
+	if(!QFileInfo(jnl_filename).exists())
+		return;
+
+	try
+	{
+		if(parseSnapshot(readFile(filename), root_def, snapshot_id, segments) &&
+			 parseJournal(readFile(jnl_filename), snapshot_id, root_def, segments))
+			writeSnapshot(filename, root_def, snapshot_id, segments);
+
+		QFile::remove(jnl_filename);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
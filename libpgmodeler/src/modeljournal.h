@@ -0,0 +1,119 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2015 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgmodeler
+\class ModelJournal
+\brief Implements the incremental saving of the temporary model files. The temporary file is a
+regular model file (snapshot) in which the XML code of each object is preceded by a comment
+identifying it. Between two snapshots only the code of the objects modified since the last saving
+(see BaseObject::getModificationId) and the identification of the removed ones are appended to
+a journal file. The journal is merged into the snapshot by replayJournal() before restoring the model.
+\note Each journal transaction is terminated by a commit record so an incomplete transaction
+(e.g. the application crashed during the writing) is discarded on replay.
+*/
+
+#ifndef MODEL_JOURNAL_H
+#define MODEL_JOURNAL_H
+
+#include "databasemodel.h"
+
+class ModelJournal {
+	private:
+		//! \brief Identifies the code of an object on the temporary file (section, object id)
+		typedef pair<unsigned, unsigned> SegmentKey;
+
+		//! \brief Sections of the model file. The objects are written in the order of the sections
+		static const unsigned REGULAR_SECTION=0,
+		FK_SECTION=1,
+		FK_REL_SECTION=2,
+		PERMISSION_SECTION=3,
+
+		//! \brief Maximum amount of journal transactions appended before writing a new snapshot
+		SNAPSHOT_INTERVAL=30;
+
+		//! \brief Markers and extension used by the snapshot and journal files
+		static const QString SNAPSHOT_MARKER,
+		SEGMENT_MARKER,
+		JOURNAL_EXT;
+
+		//! \brief Model being saved
+		DatabaseModel *model;
+
+		//! \brief Path to the temporary model file (snapshot)
+		QString filename,
+
+		//! \brief Identifier of the current snapshot. A journal is replayed only on the snapshot with the same identifier
+		snapshot_id,
+
+		//! \brief Code of the root element and of the database as stored on the temporary file
+		root_def, db_def;
+
+		//! \brief Modification ids of the objects as stored on the temporary file
+		map<SegmentKey, unsigned long long> saved_ids;
+
+		//! \brief Amount of transactions appended to the journal since the last snapshot
+		unsigned journal_count;
+
+		//! \brief Size of the last snapshot written (in bytes)
+		qint64 snapshot_size;
+
+		//! \brief Returns the objects that are written on the model file indexed by their segment keys
+		map<SegmentKey, BaseObject *> getObjects(void);
+
+		//! \brief Writes a full snapshot of the model and discards the current journal
+		void writeSnapshot(void);
+
+		//! \brief Appends to the journal the code of the objects modified since the last saving
+		void appendJournal(void);
+
+		//! \brief Returns the segment key of the object
+		static SegmentKey getSegmentKey(BaseObject *object);
+
+		//! \brief Writes the snapshot file returning its size in bytes
+		static qint64 writeSnapshot(const QString &filename, const QString &root_def, const QString &snapshot_id, map<SegmentKey, QString> &segments);
+
+		//! \brief Reads the whole contents of the (UTF-8) file
+		static QString readFile(const QString &filename);
+
+		//! \brief Extracts the root element code, the snapshot id and the objects segments from the snapshot contents
+		static bool parseSnapshot(const QString &buffer, QString &root_def, QString &snapshot_id, map<SegmentKey, QString> &segments);
+
+		/*! \brief Applies the committed transactions of the journal contents over the snapshot segments.
+		Returns true when at least one transaction was applied */
+		static bool parseJournal(const QString &buffer, const QString &snapshot_id, QString &root_def, map<SegmentKey, QString> &segments);
+
+	public:
+		ModelJournal(DatabaseModel *model, const QString &filename);
+
+		/*! \brief Saves the model on the temporary file appending a journal transaction or, when the
+		journal is too large or there is no valid snapshot, writing a full snapshot */
+		void saveModel(void);
+
+		//! \brief Forces the writing of a full snapshot on the next saving
+		void reset(void);
+
+		//! \brief Returns the path to the journal file of the specified temporary model file
+		static QString getJournalFilename(const QString &filename);
+
+		/*! \brief Merges the journal (if exists) into the temporary model file and removes the journal.
+		After calling this method the temporary file can be loaded as any regular model file */
+		static void replayJournal(const QString &filename);
+};
+
+#endif
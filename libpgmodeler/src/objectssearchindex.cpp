@@ -0,0 +1,398 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2015 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "objectssearchindex.h"
+#include "function.h"
+#include "view.h"
+#include "constraint.h"
+#include "trigger.h"
+#include "index.h"
+#include "rule.h"
+#include "domain.h"
+#include "column.h"
+#include <algorithm>
+
+void ObjectsSearchIndex::updateIndex(vector<BaseObject *> &objects)
+{
+	map<BaseObject *, IndexEntry>::iterator itr;
+
+	for(auto &object : objects)
+	{
+		itr=entries.find(object);
+
+		if(itr==entries.end() || itr->second.mod_id!=getIndexVersion(object))
+			indexObject(object);
+	}
+}
+
+void ObjectsSearchIndex::indexObject(BaseObject *object)
+{
+	IndexEntry &entry=entries[object];
+	vector<quint64> trigrams;
+
+	removePostings(object, entry);
+
+	entry.mod_id=getIndexVersion(object);
+	entry.name=object->getName();
+	entry.fmt_name=getFormattedName(object);
+	entry.definition=getDefinitionText(object);
+
+	//The trigrams of all texts are stored together, the checking of the pattern decides which text matches
+	entry.trigrams=extractTrigrams(entry.name);
+	trigrams=extractTrigrams(entry.fmt_name + QChar('\n') + entry.definition);
+	entry.trigrams.insert(entry.trigrams.end(), trigrams.begin(), trigrams.end());
+	std::sort(entry.trigrams.begin(), entry.trigrams.end());
+	entry.trigrams.erase(std::unique(entry.trigrams.begin(), entry.trigrams.end()), entry.trigrams.end());
+
+	for(auto &trigram : entry.trigrams)
+		postings[trigram].insert(object);
+}
+
+void ObjectsSearchIndex::removePostings(BaseObject *object, IndexEntry &entry)
+{
+	map<quint64, set<BaseObject *>>::iterator itr;
+
+	for(auto &trigram : entry.trigrams)
+	{
+		itr=postings.find(trigram);
+
+		if(itr!=postings.end())
+		{
+			itr->second.erase(object);
+
+			if(itr->second.empty())
+				postings.erase(itr);
+		}
+	}
+
+	entry.trigrams.clear();
+}
+
+void ObjectsSearchIndex::removeObject(BaseObject *object)
+{
+	map<BaseObject *, IndexEntry>::iterator itr=entries.find(object);
+
+	if(itr!=entries.end())
+	{
+		removePostings(object, itr->second);
+		entries.erase(itr);
+	}
+}
+
+void ObjectsSearchIndex::clear(void)
+{
+	entries.clear();
+	postings.clear();
+}
+
+unsigned long long ObjectsSearchIndex::getIndexVersion(BaseObject *object)
+{
+	TableObject *tab_obj=dynamic_cast<TableObject *>(object);
+	BaseObject *parent=(tab_obj ? tab_obj->getParentTable() : nullptr);
+	unsigned long long version=object->getModificationId();
+
+	/* The formatted name includes the parent table and schema names so changes on them must
+	cause the reindexing too. Since modification ids are always increasing the greatest one is used */
+	if(parent)
+		version=std::max(version, parent->getModificationId());
+	else
+		parent=object;
+
+	if(parent->getSchema())
+		version=std::max(version, parent->getSchema()->getModificationId());
+
+	return(version);
+}
+
+QString ObjectsSearchIndex::getFormattedName(BaseObject *object)
+{
+	TableObject *tab_obj=dynamic_cast<TableObject *>(object);
+	QString name;
+
+	if(tab_obj && tab_obj->getParentTable())
+		name=tab_obj->getParentTable()->getName(true);
+
+	name+=object->getName(true, true);
+	name.remove('"');
+
+	return(name);
+}
+
+QString ObjectsSearchIndex::getDefinitionText(BaseObject *object)
+{
+	QStringList texts;
+	ObjectType obj_type=object->getObjectType();
+
+	texts.push_back(object->getComment());
+
+	if(obj_type==OBJ_FUNCTION)
+	{
+		Function *func=dynamic_cast<Function *>(object);
+		texts.push_back(func->getSourceCode());
+		texts.push_back(func->getSymbol());
+	}
+	else if(obj_type==OBJ_VIEW)
+	{
+		View *view=dynamic_cast<View *>(object);
+
+		texts.push_back(view->getCommomTableExpression());
+
+		for(unsigned i=0; i < view->getReferenceCount(); i++)
+			texts.push_back(view->getReference(i).getExpression());
+	}
+	else if(obj_type==OBJ_CONSTRAINT)
+		texts.push_back(dynamic_cast<Constraint *>(object)->getExpression());
+	else if(obj_type==OBJ_TRIGGER)
+		texts.push_back(dynamic_cast<Trigger *>(object)->getCondition());
+	else if(obj_type==OBJ_INDEX)
+		texts.push_back(dynamic_cast<Index *>(object)->getPredicate());
+	else if(obj_type==OBJ_RULE)
+	{
+		Rule *rule=dynamic_cast<Rule *>(object);
+
+		texts.push_back(rule->getConditionalExpression());
+
+		for(unsigned i=0; i < rule->getCommandCount(); i++)
+			texts.push_back(rule->getCommand(i));
+	}
+	else if(obj_type==OBJ_DOMAIN)
+	{
+		texts.push_back(dynamic_cast<Domain *>(object)->getExpression());
+		texts.push_back(dynamic_cast<Domain *>(object)->getDefaultValue());
+	}
+	else if(obj_type==OBJ_COLUMN)
+		texts.push_back(dynamic_cast<Column *>(object)->getDefaultValue());
+
+	texts.push_back(object->getAppendedSQL());
+	texts.push_back(object->getPrependedSQL());
+	texts.removeAll(QString());
+
+	return(texts.join(QChar('\n')));
+}
+
+vector<quint64> ObjectsSearchIndex::extractTrigrams(const QString &text)
+{
+	vector<quint64> trigrams;
+	QString lower_text=text.toLower();
+	int len=lower_text.size();
+
+	if(len >= 3)
+	{
+		trigrams.reserve(len - 2);
+
+		for(int i=0; i < len - 2; i++)
+		{
+			trigrams.push_back((static_cast<quint64>(lower_text[i].unicode()) << 32) |
+												 (static_cast<quint64>(lower_text[i+1].unicode()) << 16) |
+												 static_cast<quint64>(lower_text[i+2].unicode()));
+		}
+
+		std::sort(trigrams.begin(), trigrams.end());
+		trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+	}
+
+	return(trigrams);
+}
+
+QStringList ObjectsSearchIndex::extractLiterals(const QString &pattern, bool is_regexp, bool exact_match)
+{
+	QStringList literals;
+	QString literal;
+	int i=0, len=pattern.size(), depth=0;
+	QChar chr;
+
+	if(!is_regexp)
+	{
+		//Fixed strings are literals as is
+		if(exact_match)
+			literals.push_back(pattern);
+		else
+		{
+			//Wildcard patterns: the fragments between the special chars (*, ? and [...]) are literals
+			while(i < len)
+			{
+				chr=pattern[i];
+
+				if(chr=='*' || chr=='?')
+				{
+					literals.push_back(literal);
+					literal.clear();
+				}
+				else if(chr=='[')
+				{
+					literals.push_back(literal);
+					literal.clear();
+					i=pattern.indexOf(']', i + 2);
+					if(i < 0) i=len;
+				}
+				else
+					literal+=chr;
+
+				i++;
+			}
+
+			literals.push_back(literal);
+		}
+	}
+	//Alternations can match any of the branches so no literal is mandatory
+	else if(!pattern.contains('|'))
+	{
+		while(i < len)
+		{
+			chr=pattern[i];
+
+			if(chr=='\\' && i + 1 < len)
+			{
+				//Escaped punctuation is a literal char, other escapes are char classes or back references
+				if(!pattern[i+1].isLetterOrNumber() && depth==0)
+					literal+=pattern[i+1];
+				else
+				{
+					literals.push_back(literal);
+					literal.clear();
+				}
+				i+=2;
+				continue;
+			}
+
+			if(chr=='*' || chr=='?' || chr=='{')
+			{
+				//The previous char is optional so it's removed from the literal
+				literal.chop(1);
+				literals.push_back(literal);
+				literal.clear();
+
+				if(chr=='{')
+				{
+					i=pattern.indexOf('}', i);
+					if(i < 0) i=len;
+				}
+			}
+			else if(chr=='[')
+			{
+				literals.push_back(literal);
+				literal.clear();
+				i=pattern.indexOf(']', i + 2);
+				if(i < 0) i=len;
+			}
+			else if(chr=='(' || chr==')')
+			{
+				//Groups may be optional or repeated so their contents are not used as literals
+				depth+=(chr=='(' ? 1 : -1);
+				literals.push_back(literal);
+				literal.clear();
+			}
+			else if(chr=='.' || chr=='^' || chr=='$' || chr=='+')
+			{
+				literals.push_back(literal);
+				literal.clear();
+			}
+			else if(depth==0)
+				literal+=chr;
+
+			i++;
+		}
+
+		literals.push_back(literal);
+	}
+
+	return(literals.filter(QRegExp(QString("^.{3,}$"))));
+}
+
+vector<BaseObject *> ObjectsSearchIndex::findObjects(vector<BaseObject *> &objects, const QString &pattern, bool format_obj_names,
+																										 bool search_defs, bool case_sensitive, bool is_regexp, bool exact_match)
+{
+	vector<BaseObject *> list;
+	vector<quint64> trigrams, aux_trigrams;
+	vector<set<BaseObject *> *> obj_sets;
+	set<BaseObject *> candidates;
+	map<quint64, set<BaseObject *>>::iterator itr;
+	QRegExp regexp;
+	bool use_candidates=false, found=false;
+
+	updateIndex(objects);
+
+	//Configuring the regex style
+	regexp.setPattern(pattern);
+	regexp.setCaseSensitivity(case_sensitive ?  Qt::CaseSensitive :  Qt::CaseInsensitive);
+
+	if(is_regexp)
+		regexp.setPatternSyntax(QRegExp::RegExp2);
+	else if(exact_match)
+		regexp.setPatternSyntax(QRegExp::FixedString);
+	else
+		regexp.setPatternSyntax(QRegExp::Wildcard);
+
+	//Gathering the trigrams that must exist on a matching object
+	for(auto &literal : extractLiterals(pattern, is_regexp, exact_match))
+	{
+		aux_trigrams=extractTrigrams(literal);
+		trigrams.insert(trigrams.end(), aux_trigrams.begin(), aux_trigrams.end());
+	}
+
+	if(!trigrams.empty())
+	{
+		use_candidates=true;
+
+		for(auto &trigram : trigrams)
+		{
+			itr=postings.find(trigram);
+
+			//A mandatory trigram isn't present in any object so nothing matches
+			if(itr==postings.end())
+				return(list);
+
+			obj_sets.push_back(&itr->second);
+		}
+
+		//Intersecting the objects sets starting from the smaller one
+		std::sort(obj_sets.begin(), obj_sets.end(),
+							[](set<BaseObject *> *s1, set<BaseObject *> *s2){ return(s1->size() < s2->size()); });
+
+		for(auto &object : *obj_sets[0])
+		{
+			found=true;
+
+			for(unsigned i=1; i < obj_sets.size() && found; i++)
+				found=(obj_sets[i]->count(object) > 0);
+
+			if(found)
+				candidates.insert(object);
+		}
+	}
+
+	/* Only the objects in the provided list are returned (the index may contain
+	objects of other types or already removed ones which must not be accessed) */
+	for(auto &object : objects)
+	{
+		if(use_candidates && candidates.count(object)==0)
+			continue;
+
+		IndexEntry &entry=entries[object];
+		QString &obj_name=(format_obj_names ? entry.fmt_name : entry.name);
+
+		//Try to match the name on the configured regexp
+		if((exact_match && pattern==obj_name) ||
+			 (exact_match && regexp.exactMatch(obj_name)) ||
+			 (!exact_match && regexp.indexIn(obj_name) >= 0) ||
+			 (search_defs && !entry.definition.isEmpty() && regexp.indexIn(entry.definition) >= 0))
+			list.push_back(object);
+	}
+
+	return(list);
+}
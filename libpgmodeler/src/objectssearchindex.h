@@ -0,0 +1,99 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2015 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgmodeler
+\class ObjectsSearchIndex
+\brief Implements a trigram based inverted index over the names, comments and source text
+(function bodies, view definitions, constraint expressions, etc) of the database model objects.
+\note The index is updated incrementally: an object is reindexed only when its modification id
+(see BaseObject::getModificationId) differs from the one stored when it was indexed. The trigrams
+extracted from the search pattern are used to select the candidate objects which are then
+checked against the pattern itself, this way only a small fraction of the objects is matched.
+*/
+
+#ifndef OBJECTS_SEARCH_INDEX_H
+#define OBJECTS_SEARCH_INDEX_H
+
+#include <QStringList>
+#include <map>
+#include <set>
+#include <vector>
+#include "baseobject.h"
+
+class ObjectsSearchIndex {
+	private:
+		//! \brief Stores the indexed data of a single object
+		struct IndexEntry {
+			//! \brief Version of the object when it was indexed (see getIndexVersion())
+			unsigned long long mod_id;
+
+			//! \brief Object's name, formatted name (parent/schema prepended, no quotes) and comment/source text
+			QString name, fmt_name, definition;
+
+			//! \brief Sorted trigrams extracted from the texts above (lower cased)
+			vector<quint64> trigrams;
+		};
+
+		//! \brief Stores the indexed objects
+		map<BaseObject *, IndexEntry> entries;
+
+		//! \brief Inverted index (trigram -> objects containing it)
+		map<quint64, set<BaseObject *>> postings;
+
+		//! \brief Indexes (or reindexes) the object
+		void indexObject(BaseObject *object);
+
+		//! \brief Removes the trigrams of the object from the inverted index
+		void removePostings(BaseObject *object, IndexEntry &entry);
+
+		/*! \brief Returns the version of the object used to detect outdated entries. The modification ids
+		of the parent table and the schema are considered since they are part of the formatted name */
+		static unsigned long long getIndexVersion(BaseObject *object);
+
+		//! \brief Returns the name used by the search when object names must be formatted
+		static QString getFormattedName(BaseObject *object);
+
+		//! \brief Returns the comment and the source text (bodies, expressions, definitions) of the object
+		static QString getDefinitionText(BaseObject *object);
+
+		//! \brief Returns the sorted and unique trigrams of the text (lower cased)
+		static vector<quint64> extractTrigrams(const QString &text);
+
+		/*! \brief Returns the literal fragments that any text matching the pattern must contain.
+		An empty list means that no fragment could be safely extracted (e.g. alternations on regexp) */
+		static QStringList extractLiterals(const QString &pattern, bool is_regexp, bool exact_match);
+
+	public:
+		//! \brief Indexes the objects in the list that are not indexed yet or were modified since the last indexing
+		void updateIndex(vector<BaseObject *> &objects);
+
+		//! \brief Removes the object from the index. This method doesn't access the object so it can be called during its destruction
+		void removeObject(BaseObject *object);
+
+		//! \brief Clears the whole index
+		void clear(void);
+
+		/*! \brief Returns the objects of the provided list that matches the pattern. The pattern is matched against the names
+		of the objects and, if search_defs is true, against their comments and source text too. The other parameters have
+		the same meaning of the ones in DatabaseModel::findObjects() */
+		vector<BaseObject *> findObjects(vector<BaseObject *> &objects, const QString &pattern, bool format_obj_names,
+																		 bool search_defs, bool case_sensitive, bool is_regexp, bool exact_match);
+};
+
+#endif
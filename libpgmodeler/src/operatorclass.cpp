@@ -170,6 +170,7 @@ QString OperatorClass::getCodeDefinition(unsigned def_type, bool reduced_form)
 {
 	QString code_def=getCachedCode(def_type, reduced_form);
 	if(!code_def.isEmpty()) return(code_def);
+	CodeGenerationGuard gen_guard(this);
 
 	setElementsAttribute(def_type);
 	attributes[ParsersAttributes::INDEX_TYPE]=(~indexing_type);
@@ -87,6 +87,7 @@ QString Parameter::getCodeDefinition(unsigned def_type)
 {
 	QString code_def=getCachedCode(def_type, false);
 	if(!code_def.isEmpty()) return(code_def);
+	CodeGenerationGuard gen_guard(this);
 
 	return(this->getCodeDefinition(def_type, false));
 }
@@ -386,6 +386,7 @@ QString Permission::getCodeDefinition(unsigned def_type)
 {
 	QString code_def=getCachedCode(def_type, false);
 	if(!code_def.isEmpty()) return(code_def);
+	CodeGenerationGuard gen_guard(this);
 
 	unsigned i, count;
 	ObjectType obj_type;
@@ -125,6 +125,7 @@ QString Rule::getCodeDefinition(unsigned def_type)
 {
 	QString code_def=getCachedCode(def_type, false);
 	if(!code_def.isEmpty()) return(code_def);
+	CodeGenerationGuard gen_guard(this);
 
 	setCommandsAttribute();
 	attributes[ParsersAttributes::CONDITION]=conditional_expr;
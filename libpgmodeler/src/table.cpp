@@ -124,12 +124,12 @@ void Table::setCommentAttribute(TableObject *tab_obj)
     attribs[ParsersAttributes::NAME]=tab_obj->getName(true);
 		attribs[ParsersAttributes::COMMENT]=tab_obj->getComment();
 
-		schparser.ignoreUnkownAttributes(true);
+		SchemaParserModeGuard guard(schparser, true, schparser.isIgnoringEmptyAttributes());
+
 		if(tab_obj->isSQLDisabled())
       attributes[ParsersAttributes::COLS_COMMENT]+=QString("-- ");
 
 		attributes[ParsersAttributes::COLS_COMMENT]+=schparser.getCodeDefinition(ParsersAttributes::COMMENT, attribs, SchemaParser::SQL_DEFINITION);
-		schparser.ignoreUnkownAttributes(false);
 	}
 }
 
@@ -608,6 +608,7 @@ void Table::removeObject(unsigned obj_idx, ObjectType obj_type)
 
       tab_obj->setParentTable(nullptr);
 			obj_list->erase(itr);
+			removeFromSearchIndex(tab_obj);
 
       if(constr && constr->getConstraintType()==ConstraintType::primary_key)
         dynamic_cast<Constraint *>(tab_obj)->setColumnsNotNull(false);
@@ -638,6 +639,7 @@ void Table::removeObject(unsigned obj_idx, ObjectType obj_type)
 
 			column->setParentTable(nullptr);
 			columns.erase(itr);
+			removeFromSearchIndex(column);
 		}
 	}
 
@@ -1340,6 +1342,7 @@ QString Table::getCodeDefinition(unsigned def_type)
 {
 	QString code_def=getCachedCode(def_type, false);
 	if(!code_def.isEmpty()) return(code_def);
+	CodeGenerationGuard gen_guard(this);
 
 	attributes[ParsersAttributes::OIDS]=(with_oid ? ParsersAttributes::_TRUE_ : QString());
 	attributes[ParsersAttributes::GEN_ALTER_CMDS]=(gen_alter_cmds ? ParsersAttributes::_TRUE_ : QString());
@@ -62,6 +62,7 @@ QString Tablespace::getCodeDefinition(unsigned def_type)
 {
 	QString code_def=getCachedCode(def_type, false);
 	if(!code_def.isEmpty()) return(code_def);
+	CodeGenerationGuard gen_guard(this);
 
   if(!directory.isEmpty())
     attributes[ParsersAttributes::DIRECTORY]=QString("'") + directory + QString("'");
@@ -51,6 +51,7 @@ void Tag::setName(const QString &name)
 
 QString Tag::getName(bool, bool)
 {
+  registerCodeDependency();
   return(this->obj_name);
 }
 
@@ -147,6 +148,7 @@ QString Tag::getCodeDefinition(unsigned def_type, bool reduced_form)
   {
 		QString code_def=getCachedCode(def_type, reduced_form);
 		if(!code_def.isEmpty()) return(code_def);
+		CodeGenerationGuard gen_guard(this);
 
     try
     {
@@ -38,6 +38,7 @@ QString Textbox::getCodeDefinition(unsigned def_type)
 	{
 		QString code_def=getCachedCode(def_type, false);
 		if(!code_def.isEmpty()) return(code_def);
+		CodeGenerationGuard gen_guard(this);
 
 		setPositionAttribute();
 
@@ -556,6 +556,7 @@ QString View::getCodeDefinition(unsigned def_type)
 {
 	QString code_def=getCachedCode(def_type, false);
 	if(!code_def.isEmpty()) return(code_def);
+	CodeGenerationGuard gen_guard(this);
 
 	attributes[ParsersAttributes::CTE_EXPRESSION]=cte_expression;
   attributes[ParsersAttributes::MATERIALIZED]=(materialized ? ParsersAttributes::_TRUE_ : QString());
@@ -724,6 +725,7 @@ void View::removeObject(unsigned obj_idx, ObjectType obj_type)
 
 	itr=obj_list->begin() + obj_idx;
 	(*itr)->setParentTable(nullptr);
+	removeFromSearchIndex(*itr);
 	obj_list->erase(itr);
 	setCodeInvalidated(true);
 }
@@ -11,6 +11,7 @@ include(../pgmodeler.pri)
 
 TEMPLATE = lib
 TARGET = pgmodeler_ui
+QT += svg
 RESOURCES += res/resources.qrc
 windows:RCC_DIR += src
 windows:DESTDIR = $$PWD
@@ -69,6 +70,7 @@ SOURCES += src/mainwindow.cpp \
 	   src/collationwidget.cpp \
 	   src/elementswidget.cpp \
 	   src/modelexporthelper.cpp \
+	   src/pngstreamwriter.cpp \
 	   src/modelvalidationwidget.cpp \
 	   src/modelvalidationhelper.cpp \
 	   src/validationinfo.cpp \
@@ -155,6 +157,7 @@ HEADERS += src/mainwindow.h \
 	   src/collationwidget.h \
 	   src/elementswidget.h \
 	   src/modelexporthelper.h \
+	   src/pngstreamwriter.h \
 	   src/modelvalidationwidget.h \
 	   src/modelvalidationhelper.h \
 	   src/validationinfo.h \
@@ -265,7 +268,8 @@ unix|windows: LIBS += -L$$OUT_PWD/../libobjrenderer/ -lobjrenderer \
                       -L$$OUT_PWD/../libpgconnector/ -lpgconnector \
                       -L$$OUT_PWD/../libpgmodeler/ -lpgmodeler \
                       -L$$OUT_PWD/../libparsers/ -lparsers \
-                      -L$$OUT_PWD/../libutils/ -lutils
+                      -L$$OUT_PWD/../libutils/ -lutils \
+                      $$ZLIB_LIB
 
 INCLUDEPATH += $$PWD/../libobjrenderer/src \
                $$PWD/../libpgconnector/src \
@@ -168,6 +168,9 @@ void DatabaseImportForm::importDatabase(void)
 		model_wgt=new ModelWidget;
 		model_wgt->getDatabaseModel()->createSystemObjects(true);
 
+		//The imported objects' graphical representation is configured once when the import finishes
+		model_wgt->scene->startBulkInsertion();
+
     import_helper->setImportOptions(import_sys_objs_chk->isChecked(), import_ext_objs_chk->isChecked(),
 																	 resolve_deps_chk->isChecked(), ignore_errors_chk->isChecked(),
 																	 debug_mode_chk->isChecked(), rand_rel_color_chk->isChecked());
@@ -436,6 +439,7 @@ void DatabaseImportForm::handleImportFinished(Exception e)
 		msgbox.show(e, e.getErrorMessage(), Messagebox::ALERT_ICON);
 	}
 
+	model_wgt->scene->finishBulkInsertion();
 	model_wgt->rearrangeSchemas(QPointF(origin_sb->value(), origin_sb->value()),
 															tabs_per_row_sb->value(), sch_per_row_sb->value(), obj_spacing_sb->value());
   model_wgt->getDatabaseModel()->setInvalidated(false);
@@ -147,7 +147,9 @@ void DatabaseImportHelper::swapSequencesTablesIds(void)
 	{
 		sequence=dbmodel->getObject(getObjectName(itr->first), OBJ_SEQUENCE);
 		table=dbmodel->getObject(getObjectName(itr->second), OBJ_TABLE);
-		if(sequence && table)
+
+		//The ids are swapped only when the sequence was created after its owner table
+		if(sequence && table && sequence->getObjectId() > table->getObjectId())
 			BaseObject::swapObjectsIds(sequence, table, false);
 		itr++;
 	}
@@ -226,7 +228,7 @@ void DatabaseImportHelper::retrieveUserObjects(void)
 		while(itr!=objects.end() && !import_canceled)
 		{
 			oid=itr->at(ParsersAttributes::OID).toUInt();
-			user_objs[oid]=(*itr);
+			user_objs[oid]=std::move(*itr);
 			itr++;
 		}
 
@@ -265,11 +267,11 @@ void DatabaseImportHelper::retrieveTableColumns(const QString &sch_name, const Q
 
     cols=catalog.getObjectsAttributes(OBJ_COLUMN, sch_name, tab_name, col_ids);
 
-    for(auto itr : cols)
+    for(auto &itr : cols)
     {
       col_oid=itr.at(ParsersAttributes::OID).toUInt();
       tab_oid=itr.at(ParsersAttributes::TABLE).toUInt();
-      columns[tab_oid][col_oid]=itr;
+      columns[tab_oid][col_oid]=std::move(itr);
     }
   }
   catch(Exception &e)
@@ -287,6 +289,9 @@ void DatabaseImportHelper::createObjects(void)
   vector<unsigned> not_created_objs, oids;
   vector<unsigned>::iterator itr, itr_end;
   vector<Exception> aux_errors;
+  Exception error;
+
+	sortCreationOrder();
 
 	for(i=0; i < creation_order.size() && !import_canceled; i++)
 	{
@@ -294,28 +299,23 @@ void DatabaseImportHelper::createObjects(void)
 		attribs=user_objs[oid];
 		obj_type=static_cast<ObjectType>(attribs[ParsersAttributes::OBJECT_TYPE].toUInt());
 
-		try
+		/* Constraints are ignored in these phase being pushed into an auxiliary list
+			 in order to be created later */
+		if(obj_type!=OBJ_CONSTRAINT)
 		{
-			/* Constraints are ignored in these phase being pushed into an auxiliary list
-				 in order to be created later */
-			if(obj_type!=OBJ_CONSTRAINT)
-			{
-				emit s_progressUpdated(progress,
-                               trUtf8("Creating object `%1' (%2)...")
-															 .arg(attribs[ParsersAttributes::NAME])
-															 .arg(BaseObject::getTypeName(obj_type)),
-															 obj_type);
+			emit s_progressUpdated(progress,
+														 trUtf8("Creating object `%1' (%2)...")
+														 .arg(attribs[ParsersAttributes::NAME])
+														 .arg(BaseObject::getTypeName(obj_type)),
+														 obj_type);
 
-				createObject(attribs);
-			}
-			else
-				constr_creation_order.push_back(oid);
-		}
-    catch(Exception &)
-		{
-      //Storing the object id when some error occurs in order to try to create it again below
-      not_created_objs.push_back(oid);
+			/* Storing the object id when some error occurs in order to try to create it again below.
+				 The error itself is discarded since it's expected for objects with dependencies not created yet */
+			if(!tryCreateObject(attribs))
+				not_created_objs.push_back(oid);
 		}
+		else
+			constr_creation_order.push_back(oid);
 
 		progress=(i/static_cast<float>(creation_order.size())) * 100;
     sleepThread(10);
@@ -341,7 +341,8 @@ void DatabaseImportHelper::createObjects(void)
       //Scan the oid list recreating the objects
       while(itr!=itr_end && !import_canceled)
       {
-        attribs=user_objs[*itr];
+        oid=*itr;
+        attribs=user_objs[oid];
         obj_type=static_cast<ObjectType>(attribs[ParsersAttributes::OBJECT_TYPE].toUInt());
         itr++;
 
@@ -351,15 +352,11 @@ void DatabaseImportHelper::createObjects(void)
                                .arg(BaseObject::getTypeName(obj_type)),
                                obj_type);
 
-        try
-        {   
-          createObject(attribs);
-        }
-        catch(Exception &e)
+        //In case of some error store the oid and the error in separated lists
+        if(!tryCreateObject(attribs, &error))
         {
-          //In case of some error store the oid and the error in separated lists
-          not_created_objs.push_back(*itr);
-          aux_errors.push_back(e);
+          not_created_objs.push_back(oid);
+          aux_errors.push_back(error);
         }
 
         progress=(i/static_cast<float>(not_created_objs.size())) * 100;
@@ -383,6 +380,75 @@ void DatabaseImportHelper::createObjects(void)
   }
 }
 
+void DatabaseImportHelper::sortCreationOrder(void)
+{
+	try
+	{
+		map<unsigned, vector<unsigned>> deps, dependents;
+		map<unsigned, vector<unsigned>>::iterator dep_itr;
+		map<unsigned, unsigned> pending_deps;
+		set<unsigned> remaining(creation_order.begin(), creation_order.end()), ready;
+		vector<unsigned> sorted;
+		unsigned oid=0;
+
+		emit s_progressUpdated(0, trUtf8("Sorting objects by their dependencies..."), BASE_OBJECT);
+		deps=catalog.getObjectsDependencies();
+
+		//Counting for each object the amount of dependencies that are also being imported
+		for(unsigned obj_oid : remaining)
+		{
+			pending_deps[obj_oid]=0;
+			dep_itr=deps.find(obj_oid);
+
+			if(dep_itr==deps.end())
+				continue;
+
+			for(unsigned ref_oid : dep_itr->second)
+			{
+				if(remaining.count(ref_oid))
+				{
+					pending_deps[obj_oid]++;
+					dependents[ref_oid].push_back(obj_oid);
+				}
+			}
+		}
+
+		for(auto &itr : pending_deps)
+		{
+			if(itr.second==0)
+				ready.insert(itr.first);
+		}
+
+		sorted.reserve(remaining.size());
+
+		while(!remaining.empty() && !import_canceled)
+		{
+			//When there is a dependency cycle the object with the lowest oid is released (as in the original oid order)
+			if(ready.empty())
+				ready.insert(*remaining.begin());
+
+			oid=*ready.begin();
+			ready.erase(ready.begin());
+			remaining.erase(oid);
+			sorted.push_back(oid);
+
+			//Releasing the objects that were waiting only for the object above
+			for(unsigned dep_oid : dependents[oid])
+			{
+				if(remaining.count(dep_oid) && --pending_deps[dep_oid]==0)
+					ready.insert(dep_oid);
+			}
+		}
+
+		if(!import_canceled)
+			creation_order.swap(sorted);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
 void DatabaseImportHelper::createConstraints(void)
 {
 	int progress=0;
@@ -606,81 +672,104 @@ void DatabaseImportHelper::cancelImport(void)
 }
 
 void DatabaseImportHelper::createObject(attribs_map &attribs)
+{
+	Exception error;
+
+	if(!tryCreateObject(attribs, &error))
+		throw error;
+}
+
+bool DatabaseImportHelper::tryCreateObject(attribs_map &attribs, Exception *error)
+{
+	try
+	{
+		__createObject(attribs);
+		return(true);
+	}
+	catch(Exception &e)
+	{
+		//The error is formatted only when the caller needs it
+		if(error)
+		{
+			ObjectType obj_type=static_cast<ObjectType>(attribs[ParsersAttributes::OBJECT_TYPE].toUInt());
+
+			*error=Exception(Exception::getErrorMessage(ERR_OBJECT_NOT_IMPORTED)
+											 .arg(getObjectName(attribs[ParsersAttributes::OID], (obj_type==OBJ_FUNCTION || obj_type==OBJ_OPERATOR)))
+											 .arg(BaseObject::getTypeName(obj_type)),
+											 ERR_OBJECT_NOT_IMPORTED,__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		}
+
+		return(false);
+	}
+}
+
+void DatabaseImportHelper::__createObject(attribs_map &attribs)
 {
 	unsigned oid=attribs[ParsersAttributes::OID].toUInt();
 	ObjectType obj_type=static_cast<ObjectType>(attribs[ParsersAttributes::OBJECT_TYPE].toUInt());
 	QString obj_name=getObjectName(attribs[ParsersAttributes::OID], (obj_type==OBJ_FUNCTION || obj_type==OBJ_OPERATOR));
 
-	try
-	{	
-		if(!import_canceled &&
-			 (obj_type==OBJ_DATABASE || TableObject::isTableObject(obj_type) ||
+	if(!import_canceled &&
+		 (obj_type==OBJ_DATABASE || TableObject::isTableObject(obj_type) ||
 
-			 //If the object does not exists on both model and created objects vector
-			 ((std::find(created_objs.begin(), created_objs.end(), oid)==created_objs.end()) &&
-				 dbmodel->getObjectIndex(obj_name, obj_type) < 0)))
-		{
-			if(TableObject::isTableObject(obj_type))
+		 //If the object does not exists on both model and created objects vector
+		 ((std::find(created_objs.begin(), created_objs.end(), oid)==created_objs.end()) &&
+			 dbmodel->getObjectIndex(obj_name, obj_type) < 0)))
+	{
+		if(TableObject::isTableObject(obj_type))
         attribs[ParsersAttributes::DECL_IN_TABLE]=QString();
 
-			//System objects will have the sql disabled by default
+		//System objects will have the sql disabled by default
       attribs[ParsersAttributes::SQL_DISABLED]=(oid > catalog.getLastSysObjectOID() ? QString() : ParsersAttributes::_TRUE_);
-			attribs[ParsersAttributes::COMMENT]=getComment(attribs);
+		attribs[ParsersAttributes::COMMENT]=getComment(attribs);
 
-			if(attribs.count(ParsersAttributes::OWNER))
-				attribs[ParsersAttributes::OWNER]=getDependencyObject(attribs[ParsersAttributes::OWNER], OBJ_ROLE);
+		if(attribs.count(ParsersAttributes::OWNER))
+			attribs[ParsersAttributes::OWNER]=getDependencyObject(attribs[ParsersAttributes::OWNER], OBJ_ROLE);
 
-			if(attribs.count(ParsersAttributes::TABLESPACE))
-				attribs[ParsersAttributes::TABLESPACE]=getDependencyObject(attribs[ParsersAttributes::TABLESPACE], OBJ_TABLESPACE);
+		if(attribs.count(ParsersAttributes::TABLESPACE))
+			attribs[ParsersAttributes::TABLESPACE]=getDependencyObject(attribs[ParsersAttributes::TABLESPACE], OBJ_TABLESPACE);
 
-			if(attribs.count(ParsersAttributes::SCHEMA))
-				attribs[ParsersAttributes::SCHEMA]=getDependencyObject(attribs[ParsersAttributes::SCHEMA], OBJ_SCHEMA);
+		if(attribs.count(ParsersAttributes::SCHEMA))
+			attribs[ParsersAttributes::SCHEMA]=getDependencyObject(attribs[ParsersAttributes::SCHEMA], OBJ_SCHEMA);
 
-			if(!attribs[ParsersAttributes::PERMISSION].isEmpty())
-				obj_perms.push_back(oid);
+		if(!attribs[ParsersAttributes::PERMISSION].isEmpty())
+			obj_perms.push_back(oid);
 
-			switch(obj_type)
-			{
-				case OBJ_DATABASE: configureDatabase(attribs); break;
-				case OBJ_TABLESPACE: createTablespace(attribs); break;
-				case OBJ_SCHEMA: createSchema(attribs); break;
-				case OBJ_ROLE: createRole(attribs); break;
-				case OBJ_DOMAIN: createDomain(attribs); break;
-				case OBJ_EXTENSION: createExtension(attribs); break;
-				case OBJ_FUNCTION: createFunction(attribs); break;
-				case OBJ_LANGUAGE: createLanguage(attribs); break;
-				case OBJ_OPFAMILY: createOperatorFamily(attribs); break;
-				case OBJ_OPCLASS: createOperatorClass(attribs); break;
-				case OBJ_OPERATOR: createOperator(attribs); break;
-				case OBJ_COLLATION: createCollation(attribs); break;
-				case OBJ_CAST: createCast(attribs); break;
-				case OBJ_CONVERSION: createConversion(attribs); break;
-				case OBJ_SEQUENCE: createSequence(attribs); break;
-				case OBJ_AGGREGATE: createAggregate(attribs); break;
-				case OBJ_TYPE: createType(attribs); break;
-				case OBJ_TABLE: createTable(attribs); break;
-				case OBJ_VIEW: createView(attribs); break;
-				case OBJ_RULE: createRule(attribs); break;
-				case OBJ_TRIGGER: createTrigger(attribs); break;
-				case OBJ_INDEX: createIndex(attribs); break;
-				case OBJ_CONSTRAINT: createConstraint(attribs); break;
-				case OBJ_EVENT_TRIGGER: createEventTrigger(attribs); break;
-
-				default:
+		switch(obj_type)
+		{
+			case OBJ_DATABASE: configureDatabase(attribs); break;
+			case OBJ_TABLESPACE: createTablespace(attribs); break;
+			case OBJ_SCHEMA: createSchema(attribs); break;
+			case OBJ_ROLE: createRole(attribs); break;
+			case OBJ_DOMAIN: createDomain(attribs); break;
+			case OBJ_EXTENSION: createExtension(attribs); break;
+			case OBJ_FUNCTION: createFunction(attribs); break;
+			case OBJ_LANGUAGE: createLanguage(attribs); break;
+			case OBJ_OPFAMILY: createOperatorFamily(attribs); break;
+			case OBJ_OPCLASS: createOperatorClass(attribs); break;
+			case OBJ_OPERATOR: createOperator(attribs); break;
+			case OBJ_COLLATION: createCollation(attribs); break;
+			case OBJ_CAST: createCast(attribs); break;
+			case OBJ_CONVERSION: createConversion(attribs); break;
+			case OBJ_SEQUENCE: createSequence(attribs); break;
+			case OBJ_AGGREGATE: createAggregate(attribs); break;
+			case OBJ_TYPE: createType(attribs); break;
+			case OBJ_TABLE: createTable(attribs); break;
+			case OBJ_VIEW: createView(attribs); break;
+			case OBJ_RULE: createRule(attribs); break;
+			case OBJ_TRIGGER: createTrigger(attribs); break;
+			case OBJ_INDEX: createIndex(attribs); break;
+			case OBJ_CONSTRAINT: createConstraint(attribs); break;
+			case OBJ_EVENT_TRIGGER: createEventTrigger(attribs); break;
+
+			default:
           qDebug("create method for %s isn't implemented!", BaseObject::getSchemaName(obj_type).toStdString().c_str());
-				break;
-			}
-
-			/* Register the object oid on the list of created objects to avoid creating it again
-				 on recursive object creation. (see getDependencyObject()) */
-			created_objs.push_back(oid);
+			break;
 		}
-	}
-	catch(Exception &e)
-	{
-		throw Exception(Exception::getErrorMessage(ERR_OBJECT_NOT_IMPORTED)
-										.arg(obj_name).arg(BaseObject::getTypeName(obj_type)),
-										ERR_OBJECT_NOT_IMPORTED,__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+
+		/* Register the object oid on the list of created objects to avoid creating it again
+			 on recursive object creation. (see getDependencyObject()) */
+		created_objs.push_back(oid);
 	}
 }
 
@@ -710,13 +799,12 @@ QString DatabaseImportHelper::getDependencyObject(const QString &oid, ObjectType
 
 		if(obj_oid > 0)
 		{
-			attribs_map obj_attr;
+			attribs_map obj_attr, *attribs=getObjectAttributes(obj_oid);
 			attribs_map::iterator itr=extra_attribs.begin();
 
-			if(system_objs.count(obj_oid))
-				obj_attr=system_objs[obj_oid];
-			else
-				obj_attr=user_objs[obj_oid];
+			//Copies the attributes of the object (if retrieved) since extra attributes can be appended to them
+			if(attribs)
+				obj_attr=*attribs;
 
 			/* If the attributes for the dependency does not exists and the automatic dependency
 			resolution is enable, the object's attributes will be retrieved from catalog */
@@ -804,7 +892,7 @@ void DatabaseImportHelper::loadObjectXML(ObjectType obj_type, attribs_map &attri
 			ts << xml_buf << endl;
 		}
 
-		xmlparser->loadXMLBuffer(xml_buf);
+		xmlparser->loadXMLBuffer(xml_buf, true);
 	}
 	catch(Exception &e)
 	{
@@ -1306,10 +1394,10 @@ void DatabaseImportHelper::createSequence(attribs_map &attribs)
 
     attribs[ParsersAttributes::OWNER_COLUMN]=QString();
 
-		/* If there are owner columns and the oid of sequence is greater that the owner column's table oid
-		stores the oid of both (sequence and table) in order to swap it's ids at the end of import to
-		avoid reference breaking when generation SQL code */
-		if(owner_col.size()==2 && attribs[ParsersAttributes::OID].toUInt() > owner_col[0].toUInt())
+		/* If there are owner columns stores the oid of both (sequence and table) in order to swap their ids at the
+		end of import, when the sequence was created after the table, to avoid reference breaking when generating SQL
+		code. The oids aren't compared since the creation order is defined by the dependencies (see sortCreationOrder()) */
+		if(owner_col.size()==2)
 			seq_tab_swap[attribs[ParsersAttributes::OID]]=owner_col[0];
 
 		for(int i=0; i < seq_attribs.size(); i++)
@@ -2029,6 +2117,31 @@ void DatabaseImportHelper::configureDatabase(attribs_map &attribs)
 	}
 }
 
+attribs_map *DatabaseImportHelper::getObjectAttributes(unsigned oid)
+{
+	map<unsigned, attribs_map>::iterator itr=system_objs.find(oid);
+
+	if(itr!=system_objs.end())
+		return(&itr->second);
+
+	itr=user_objs.find(oid);
+
+	if(itr!=user_objs.end())
+		return(&itr->second);
+
+	return(nullptr);
+}
+
+QString DatabaseImportHelper::getAttributeValue(const attribs_map &attribs, const QString &attrib)
+{
+	attribs_map::const_iterator itr=attribs.find(attrib);
+
+	if(itr!=attribs.end())
+		return(itr->second);
+
+	return(QString());
+}
+
 QString DatabaseImportHelper::getObjectName(const QString &oid, bool signature_form)
 {
 	unsigned obj_oid=oid.toUInt();
@@ -2037,25 +2150,21 @@ QString DatabaseImportHelper::getObjectName(const QString &oid, bool signature_f
     return(QString());
 	else
 	{
-		attribs_map obj_attr;
-
-		//Get the object from one of the maps of objects
-		if(system_objs.count(obj_oid))
-			obj_attr=system_objs[obj_oid];
-		else if(user_objs.count(obj_oid))
-			obj_attr=user_objs[obj_oid];
+		//Get the object from one of the maps of objects (the attributes are referenced instead of copied)
+		attribs_map *attribs=getObjectAttributes(obj_oid);
 
-		if(obj_attr.empty())
+		if(!attribs || attribs->empty())
       return(QString());
 		else
 		{
+			const attribs_map &obj_attr=*attribs;
 			QString sch_name,
-							obj_name=obj_attr[ParsersAttributes::NAME];
-			ObjectType obj_type=static_cast<ObjectType>(obj_attr[ParsersAttributes::OBJECT_TYPE].toUInt());
+							obj_name=getAttributeValue(obj_attr, ParsersAttributes::NAME);
+			ObjectType obj_type=static_cast<ObjectType>(getAttributeValue(obj_attr, ParsersAttributes::OBJECT_TYPE).toUInt());
 
 			//If the object accepts an schema retrieve the schema name too
 			if(BaseObject::acceptsSchema(obj_type))
-				sch_name=getObjectName(obj_attr[ParsersAttributes::SCHEMA]);
+				sch_name=getObjectName(getAttributeValue(obj_attr, ParsersAttributes::SCHEMA));
 
 			if(!sch_name.isEmpty())
         obj_name.prepend(sch_name + QString("."));
@@ -2067,8 +2176,8 @@ QString DatabaseImportHelper::getObjectName(const QString &oid, bool signature_f
 
 				if(obj_type==OBJ_FUNCTION)
 				{
-					QStringList arg_types=getTypes(obj_attr[ParsersAttributes::ARG_TYPES], false),
-											arg_modes=Catalog::parseArrayValues(obj_attr[ParsersAttributes::ARG_MODES]);
+					QStringList arg_types=getTypes(getAttributeValue(obj_attr, ParsersAttributes::ARG_TYPES), false),
+											arg_modes=Catalog::parseArrayValues(getAttributeValue(obj_attr, ParsersAttributes::ARG_MODES));
 
 					for(int i=0; i < arg_types.size(); i++)
 					{
@@ -2087,20 +2196,20 @@ QString DatabaseImportHelper::getObjectName(const QString &oid, bool signature_f
 				}
         else if(obj_type==OBJ_AGGREGATE)
         {
-          QStringList params=getTypes(obj_attr[ParsersAttributes::TYPES], false);
+          QStringList params=getTypes(getAttributeValue(obj_attr, ParsersAttributes::TYPES), false);
 
           if(params.isEmpty())
             params.push_back(QString("*"));
         }
 				else
 				{
-					if(obj_attr[ParsersAttributes::LEFT_TYPE].toUInt() > 0)
-						params.push_back(getType(obj_attr[ParsersAttributes::LEFT_TYPE], false));
+					if(getAttributeValue(obj_attr, ParsersAttributes::LEFT_TYPE).toUInt() > 0)
+						params.push_back(getType(getAttributeValue(obj_attr, ParsersAttributes::LEFT_TYPE), false));
 					else
             params.push_back(QString("NONE"));
 
-					if(obj_attr[ParsersAttributes::RIGHT_TYPE].toUInt() > 0)
-						params.push_back(getType(obj_attr[ParsersAttributes::RIGHT_TYPE], false));
+					if(getAttributeValue(obj_attr, ParsersAttributes::RIGHT_TYPE).toUInt() > 0)
+						params.push_back(getType(getAttributeValue(obj_attr, ParsersAttributes::RIGHT_TYPE), false));
 					else
             params.push_back(QString("NONE"));
 				}
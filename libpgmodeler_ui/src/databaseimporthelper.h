@@ -131,6 +131,12 @@ class DatabaseImportHelper: public QObject {
 
 		void configureDatabase(attribs_map &attribs);
 		void createObject(attribs_map &attribs);
+		void __createObject(attribs_map &attribs);
+
+		/*! \brief Creates the object without raising exceptions. Returns false in case of errors and, if the
+		error parameter is specified, stores on it the exception that would be raised by createObject() */
+		bool tryCreateObject(attribs_map &attribs, Exception *error=nullptr);
+
 		void createTablespace(attribs_map &attribs);
 		void createSchema(attribs_map &attribs);
 		void createRole(attribs_map &attribs);
@@ -158,6 +164,14 @@ class DatabaseImportHelper: public QObject {
     void __createTableInheritances(void);
     void createTableInheritances(void);
 
+		/*! \brief Returns the attributes of the object retrieved from catalog searching the system objects first
+		and then the user objects. A null pointer is returned when the object wasn't retrieved */
+		attribs_map *getObjectAttributes(unsigned oid);
+
+		/*! \brief Returns the value of an attribute retrieved from catalog without inserting it in the map
+		when absent (an empty string is returned in that case) */
+		static QString getAttributeValue(const attribs_map &attribs, const QString &attrib);
+
 		/*! \brief Retrieve the schema qualified name for the specified object oid. If the oid represents a function
 		or operator the signature can be retrieved instead by using the boolean parameter */
 		QString getObjectName(const QString &oid, bool signature_form=false);
@@ -196,6 +210,11 @@ class DatabaseImportHelper: public QObject {
 		//! \brief Clears the vectors and maps used in the import process
 		void resetImportParameters(void);
 
+		/*! \brief Sorts the creation order so each object comes after the objects it depends on (see Catalog::getObjectsDependencies()).
+		Objects without dependencies between them keep the oid order and dependency cycles are broken by releasing the object
+		with the lowest oid. This way the retry passes of createObjects() are needed only for dependencies not registered on the catalogs */
+		void sortCreationOrder(void);
+
   public:
 		DatabaseImportHelper(QObject *parent=0);
 
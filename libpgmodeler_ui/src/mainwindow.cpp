@@ -324,6 +324,9 @@ MainWindow::MainWindow(QWidget *parent, Qt::WindowFlags flags) : QMainWindow(par
 				{
 					model_file=tmp_models.front();
 					tmp_models.pop_front();
+
+					//Merges the changes stored on the journal before loading the temporary model
+					restoration_form->replayJournal(model_file);
 					this->addModel(model_file);
 
 					//Get the model widget generated from file
@@ -675,9 +678,7 @@ void MainWindow::saveTemporaryModels(void)
 				bg_saving_pb->setValue(((i+1)/static_cast<float>(count)) * 100);
 
         if(model->isModified() || !QFileInfo(model->getTempFilename()).exists())
-					model->getDatabaseModel()->saveModel(model->getTempFilename(), SchemaParser::XML_DEFINITION);
-
-				QThread::msleep(200);
+					model->saveTemporaryModel();
 			}
 
 			bg_saving_pb->setValue(100);
@@ -1082,9 +1083,8 @@ void MainWindow::closeModel(int model_id)
 			disconnect(action_show_grid, nullptr, this, nullptr);
 			disconnect(action_show_delimiters, nullptr, this, nullptr);
 
-			//Remove the temporary file related to the closed model
-			QDir arq_tmp;
-			arq_tmp.remove(model->getTempFilename());
+			//Remove the temporary file (and its journal) related to the closed model
+			restoration_form->removeTemporaryModel(model->getTempFilename());
 
 			//Removing model specific actions from general toolbar
 			removeModelActions();
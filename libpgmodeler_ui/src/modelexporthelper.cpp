@@ -1,4 +1,8 @@
 #include "modelexporthelper.h"
+#include "pngstreamwriter.h"
+#include <QtMath>
+#include <QSvgGenerator>
+#include <QPdfWriter>
 
 ModelExportHelper::ModelExportHelper(QObject *parent) : QObject(parent)
 {
@@ -52,14 +56,10 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 
 	try
 	{
-		QPixmap pix;
 		bool shw_grd, shw_dlm, align_objs;
-		QGraphicsView viewp(scene);
-		QRect retv;
-		QPolygon pol;
     vector<QRectF> pages;
-    unsigned v_cnt=0, h_cnt=0, page_idx=1;
-    QString tmpl_filename, file;
+    unsigned page_idx=1;
+    QString file;
 
 		//Clear the object scene selection to avoid drawing the selectoin rectangle of the objects
 		scene->clearSelection();
@@ -70,101 +70,84 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 		//Sets the options passed by the user
 		ObjectsScene::setGridOptions(show_grid, false, show_delim);
 
-    if(page_by_page)
-    {
-      QPrinter::Orientation orient;
-      QRectF margins;
-      QSizeF custom_sz, page_sz;
-      QPrinter::PaperSize paper_sz;
-      QPrinter prt;
-      QFileInfo fi(filename);
-
-      ObjectsScene::getPaperConfiguration(paper_sz, orient, margins, custom_sz);
-
-      if(paper_sz==QPrinter::Custom)
-        page_sz=custom_sz;
-      else
-      {
-        prt.setPaperSize(paper_sz);
-        prt.setOrientation(orient);
-        page_sz=prt.paperSize(QPrinter::Point);
-      }
-
-      //Calculates the page count to be exported
-      pages=scene->getPagesForPrinting(page_sz, margins.size(), h_cnt, v_cnt);
-
-      //Configures the template filename for pages pixmaps
-      tmpl_filename=fi.absolutePath() + GlobalAttributes::DIR_SEPARATOR + fi.baseName() + QString("_p%1.") + fi.completeSuffix();
-    }
-    else
-    {
-      QRectF rect=scene->itemsBoundingRect(true);
-
-      //Give some margin to the resulting image
-      QSizeF margin=QSizeF(5 * BaseObjectView::HORIZ_SPACING, 5 * BaseObjectView::VERT_SPACING);
-      rect.setTopLeft(rect.topLeft() - QPointF(margin.width(), margin.height()));
-      rect.setSize(rect.size() + margin);
-
-      pages.push_back(rect);
-      file=filename;
-    }
+    //Calculates the areas of the scene to be exported
+    pages=getExportPages(scene, page_by_page);
+    file=filename;
 
 		//Updates the scene to apply the change on grid and delimiter
 		scene->update();
 
-		//Configures the viewport alignment to top-left coordinates.
-		viewp.setAlignment(Qt::AlignLeft | Qt::AlignTop);
-
-		//Apply the zoom factor on the viewport
-    viewp.resetTransform();
-    viewp.centerOn(0,0);
-    viewp.scale(zoom, zoom);
-
-    QPainter painter;
     vector<QRectF>::iterator itr=pages.begin(), itr_end=pages.end();
+    QSize img_size;
 
     while(itr!=itr_end)
     {
-      //Convert the objects bounding rect to viewport coordinates to correctly draw them onto pixmap
-      pol=viewp.mapFromScene(*itr);
-      itr++;
-
-      //Configure the viewport area to be copied
-      retv.setTopLeft(pol.at(0));
-      retv.setTopRight(pol.at(1));
-      retv.setBottomRight(pol.at(2));
-      retv.setBottomLeft(pol.at(3));
-
-      //Creates the output pixmap
-      pix=QPixmap(retv.size());
-      pix.fill();
+      //Calculates the size of the output image applying the zoom factor on the page area
+      img_size=QSize(qCeil(itr->width() * zoom), qCeil(itr->height() * zoom));
 
-      //Setting optimizations on the painter
-      painter.begin(&pix);
-      painter.setRenderHint(QPainter::Antialiasing, true);
-      painter.setRenderHint(QPainter::TextAntialiasing, true);
-      painter.setRenderHint(QPainter::SmoothPixmapTransform, true);
+      if(page_by_page)
+        file=getPageFilename(filename, page_idx);
 
       emit s_progressUpdated((page_idx/static_cast<float>(pages.size())) * 90,
                              trUtf8("Rendering objects to page %1/%2.").arg(page_idx).arg(pages.size()), BASE_OBJECT);
 
-      //Render the entire viewport onto the pixmap
-      viewp.render(&painter, QRectF(QPointF(0,0), pix.size()), retv);
-      painter.end();
+      try
+      {
+        //Small images are rendered at once and saved in compressed form
+        if(static_cast<qint64>(img_size.width()) * img_size.height() <= MAX_PNG_PIXELS)
+        {
+          QImage img(img_size, QImage::Format_RGB32);
+          bool saved=false;
 
-      if(page_by_page)
-        file=tmpl_filename.arg(page_idx++);
+          if(!img.isNull())
+          {
+            img.fill(Qt::white);
+            renderScene(scene, img, QRectF(itr->topLeft(), QSizeF(img_size) / zoom));
+            saved=img.save(file);
+          }
+
+          //If the image is not saved raises an error
+          if(!saved)
+            throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_WRITTEN).arg(file),
+                            ERR_FILE_DIR_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+        }
+        else
+        {
+          /* Large images are rendered in bands which are written to the file as soon as they are
+             painted, this way the memory used doesn't depend on the image size */
+          PNGStreamWriter writer;
+          int band_height=qMax<int>(1, PNG_BAND_PIXELS / img_size.width());
+          QImage band(img_size.width(), band_height, QImage::Format_RGB32);
+          unsigned rows=0;
 
-      //If the pixmap is not saved raises an error
-      if(!pix.save(file))
+          writer.open(file, img_size.width(), img_size.height());
+
+          for(int y=0; y < img_size.height(); y+=band_height)
+          {
+            rows=qMin<int>(band_height, img_size.height() - y);
+            band.fill(Qt::white);
+            renderScene(scene, band, QRectF(itr->left(), itr->top() + (y / zoom),
+                                            img_size.width() / zoom, band_height / zoom));
+            writer.writeRows(band, rows);
+
+            emit s_progressUpdated((page_idx/static_cast<float>(pages.size())) * 90,
+                                   trUtf8("Rendering objects to page %1/%2 (%3%).")
+                                   .arg(page_idx).arg(pages.size()).arg(((y + rows) * 100) / img_size.height()), BASE_OBJECT);
+          }
+
+          writer.close();
+        }
+      }
+      catch(Exception &e)
       {
         //Restoring the scene settings before throw error
         ObjectsScene::setGridOptions(shw_grd, align_objs, shw_dlm);
         scene->update();
-
-        throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_WRITTEN).arg(/*Utf8String::create(*/file),
-                        ERR_FILE_DIR_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+        throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
       }
+
+      page_idx++;
+      itr++;
     }
 
     //Restoring the scene settings
@@ -180,6 +163,188 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 	}
 }
 
+void ModelExportHelper::exportToSVG(ObjectsScene *scene, const QString &filename, bool show_grid, bool show_delim, bool page_by_page)
+{
+	exportToVectorFile(scene, filename, show_grid, show_delim, page_by_page, false);
+}
+
+void ModelExportHelper::exportToPDF(ObjectsScene *scene, const QString &filename, bool show_grid, bool show_delim, bool page_by_page)
+{
+	exportToVectorFile(scene, filename, show_grid, show_delim, page_by_page, true);
+}
+
+void ModelExportHelper::exportToVectorFile(ObjectsScene *scene, const QString &filename, bool show_grid, bool show_delim, bool page_by_page, bool pdf_format)
+{
+	if(!scene)
+		throw Exception(ERR_ASG_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	bool shw_grd, shw_dlm, align_objs;
+	vector<QRectF> pages;
+	unsigned page_idx=1;
+	QString file=filename;
+	QPainter painter;
+	QPdfWriter *pdf_writer=nullptr;
+
+	//Clear the object scene selection to avoid drawing the selectoin rectangle of the objects
+	scene->clearSelection();
+
+	//Make a backup of the current scene options and sets the options passed by the user
+	ObjectsScene::getGridOptions(shw_grd, align_objs, shw_dlm);
+	ObjectsScene::setGridOptions(show_grid, false, show_delim);
+	scene->update();
+
+	try
+	{
+		pages=getExportPages(scene, page_by_page);
+
+		/* The PDF pages are written in the same file while the SVG pages are written in separated files.
+		 The scene units are mapped to points (72 dpi) so the vector output keeps the scene's proportions */
+		if(pdf_format)
+		{
+			pdf_writer=new QPdfWriter(filename);
+			pdf_writer->setResolution(72);
+			pdf_writer->setCreator(QString("pgModeler ") + GlobalAttributes::PGMODELER_VERSION);
+			pdf_writer->setPageMargins(QMarginsF(0, 0, 0, 0));
+		}
+
+		for(auto &page : pages)
+		{
+			emit s_progressUpdated((page_idx/static_cast<float>(pages.size())) * 90,
+														 trUtf8("Rendering objects to page %1/%2.").arg(page_idx).arg(pages.size()), BASE_OBJECT);
+
+			if(pdf_writer)
+			{
+				pdf_writer->setPageSize(QPageSize(page.size(), QPageSize::Point));
+
+				if(page_idx==1)
+					painter.begin(pdf_writer);
+				else
+					pdf_writer->newPage();
+			}
+			else
+			{
+				QSvgGenerator svg_gen;
+
+				if(page_by_page)
+					file=getPageFilename(filename, page_idx);
+
+				svg_gen.setFileName(file);
+				svg_gen.setSize(page.size().toSize());
+				svg_gen.setViewBox(QRectF(QPointF(0,0), page.size()));
+				svg_gen.setTitle(file);
+				svg_gen.setDescription(QString("pgModeler ") + GlobalAttributes::PGMODELER_VERSION);
+				painter.begin(&svg_gen);
+			}
+
+			if(!painter.isActive())
+				throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_WRITTEN).arg(file),
+												ERR_FILE_DIR_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			painter.setRenderHint(QPainter::Antialiasing, true);
+			painter.setRenderHint(QPainter::TextAntialiasing, true);
+			scene->render(&painter, QRectF(QPointF(0,0), page.size()), page, Qt::IgnoreAspectRatio);
+
+			//The SVG file is written when the painter is finished
+			if(!pdf_writer)
+				painter.end();
+
+			page_idx++;
+		}
+
+		if(painter.isActive())
+			painter.end();
+
+		if(pdf_writer)
+			delete(pdf_writer);
+
+		//Restoring the scene settings
+		ObjectsScene::setGridOptions(shw_grd, align_objs, shw_dlm);
+		scene->update();
+
+		emit s_progressUpdated(100, trUtf8("Output file `%1' successfully written.").arg(filename), BASE_OBJECT);
+		emit s_exportFinished();
+	}
+	catch(Exception &e)
+	{
+		if(painter.isActive())
+			painter.end();
+
+		if(pdf_writer)
+			delete(pdf_writer);
+
+		//Restoring the scene settings before throw error
+		ObjectsScene::setGridOptions(shw_grd, align_objs, shw_dlm);
+		scene->update();
+
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+vector<QRectF> ModelExportHelper::getExportPages(ObjectsScene *scene, bool page_by_page)
+{
+	vector<QRectF> pages;
+
+	if(page_by_page)
+	{
+		QPrinter::Orientation orient;
+		QRectF margins;
+		QSizeF custom_sz, page_sz;
+		QPrinter::PaperSize paper_sz;
+		QPrinter prt;
+		unsigned v_cnt=0, h_cnt=0;
+
+		ObjectsScene::getPaperConfiguration(paper_sz, orient, margins, custom_sz);
+
+		if(paper_sz==QPrinter::Custom)
+			page_sz=custom_sz;
+		else
+		{
+			prt.setPaperSize(paper_sz);
+			prt.setOrientation(orient);
+			page_sz=prt.paperSize(QPrinter::Point);
+		}
+
+		//Calculates the page count to be exported
+		pages=scene->getPagesForPrinting(page_sz, margins.size(), h_cnt, v_cnt);
+	}
+	else
+	{
+		QRectF rect=scene->itemsBoundingRect(true);
+
+		//Give some margin to the resulting image
+		QSizeF margin=QSizeF(5 * BaseObjectView::HORIZ_SPACING, 5 * BaseObjectView::VERT_SPACING);
+		rect.setTopLeft(rect.topLeft() - QPointF(margin.width(), margin.height()));
+		rect.setSize(rect.size() + margin);
+
+		pages.push_back(rect);
+	}
+
+	return(pages);
+}
+
+QString ModelExportHelper::getPageFilename(const QString &filename, unsigned page_idx)
+{
+	QFileInfo fi(filename);
+
+	//Configures the template filename for pages files
+	return(fi.absolutePath() + GlobalAttributes::DIR_SEPARATOR + fi.baseName() + QString("_p%1.").arg(page_idx) + fi.completeSuffix());
+}
+
+void ModelExportHelper::renderScene(ObjectsScene *scene, QImage &image, const QRectF &source)
+{
+	QPainter painter;
+
+	//Setting optimizations on the painter
+	painter.begin(&image);
+	painter.setRenderHint(QPainter::Antialiasing, true);
+	painter.setRenderHint(QPainter::TextAntialiasing, true);
+	painter.setRenderHint(QPainter::SmoothPixmapTransform, true);
+
+	//Draws the scene area over the whole image (the zoom factor is implicit in the source/target sizes)
+	scene->render(&painter, QRectF(QPointF(0,0), image.size()), source, Qt::IgnoreAspectRatio);
+	painter.end();
+}
+
 void ModelExportHelper::sleepThread(unsigned msecs)
 {
 	if(this->thread()!=qApp->thread())
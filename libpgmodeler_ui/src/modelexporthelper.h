@@ -88,6 +88,24 @@ class ModelExportHelper: public QObject {
     //! brief Stores the original object names before the call of generateRandomObjectNames()
     map<BaseObject *, QString> orig_obj_names;
 
+		/*! \brief Maximum amount of pixels of a PNG image rendered entirely in memory. Larger images
+		are rendered and written in bands of at most PNG_BAND_PIXELS pixels (see PNGStreamWriter) */
+		static const qint64 MAX_PNG_PIXELS=40000000,
+		PNG_BAND_PIXELS=4000000;
+
+		/*! \brief Returns the areas of the scene to be exported as images. When page_by_page is true the
+		areas are the pages configured for printing otherwise the area is the whole model plus a margin */
+		static vector<QRectF> getExportPages(ObjectsScene *scene, bool page_by_page);
+
+		//! \brief Returns the name of the file that stores a single page (e.g. model.png -> model_p1.png)
+		static QString getPageFilename(const QString &filename, unsigned page_idx);
+
+		//! \brief Exports the model to a vector format (PDF or SVG). See exportToPDF() and exportToSVG()
+		void exportToVectorFile(ObjectsScene *scene, const QString &filename, bool show_grid, bool show_delim, bool page_by_page, bool pdf_format);
+
+		//! \brief Renders the scene area (in scene coordinates) over the whole image
+		static void renderScene(ObjectsScene *scene, QImage &image, const QRectF &source);
+
 		//! \brief Saves the current state of ALTER command generaton for table columns/constraints
 		void saveGenAtlerCmdsStatus(DatabaseModel *db_model);
 
@@ -135,10 +153,19 @@ class ModelExportHelper: public QObject {
 		void exportToSQL(DatabaseModel *db_model, const QString &filename, const QString &pgsql_ver);
 
 		/*! \brief Exports the model to a named PNG image. The boolean parameters controls the grid exhibition
-		as well the page delimiters on the output image. The zoom parameter controls the zoom applied to the viewport
-		before draw it on the pixmap */
+		as well the page delimiters on the output image. The zoom parameter controls the zoom applied to the scene
+		before draw it on the image. Images larger than MAX_PNG_PIXELS are streamed to the file in bands
+		so the memory used doesn't grow with the image size */
     void exportToPNG(ObjectsScene *scene, const QString &filename, float zoom, bool show_grid, bool show_delim, bool page_by_page);
 
+		/*! \brief Exports the model to a named SVG file. Since the output is scalable no zoom is applied. When
+		page_by_page is true each page is exported to a separated file (in the same way as exportToPNG()) */
+		void exportToSVG(ObjectsScene *scene, const QString &filename, bool show_grid, bool show_delim, bool page_by_page);
+
+		/*! \brief Exports the model to a named PDF file. Since the output is scalable no zoom is applied. When
+		page_by_page is true each page is exported to a separated page of the same file */
+		void exportToPDF(ObjectsScene *scene, const QString &filename, bool show_grid, bool show_delim, bool page_by_page);
+
 		/*! \brief Exports the model directly to the DBMS. A valid connection must be specified. The PostgreSQL
 		version is optional, since the helper identifies the version from the server. The boolean parameter
     make the helper to ignore object duplicity errors.
@@ -25,6 +25,12 @@ ModelOverviewWidget::ModelOverviewWidget(QWidget *parent) : QWidget(parent, Qt::
 	this->model=nullptr;
 	zoom_factor=1;
 	curr_resize_factor=RESIZE_FACTOR;
+	full_update=true;
+
+	update_timer.setSingleShot(true);
+	update_timer.setInterval(UPDATE_INTERVAL);
+	connect(&update_timer, SIGNAL(timeout(void)), this, SLOT(performScheduledUpdate(void)));
+
 	this->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
 	this->setWindowFlags(Qt::WindowStaysOnTopHint);
 }
@@ -39,13 +45,12 @@ void ModelOverviewWidget::show(ModelWidget *model)
 	}
 
 	this->model=model;
+	update_timer.stop();
+	dirty_rects.clear();
+	full_update=true;
 
 	if(this->model)
 	{
-		connect(this->model, SIGNAL(s_objectCreated(void)), this, SLOT(updateOverview(void)));
-		connect(this->model, SIGNAL(s_objectRemoved(void)), this, SLOT(updateOverview(void)));
-		connect(this->model, SIGNAL(s_objectsMoved(void)), this, SLOT(updateOverview(void)));
-		connect(this->model, SIGNAL(s_objectModified(void)), this, SLOT(updateOverview(void)));
 		connect(this->model, SIGNAL(s_zoomModified(float)), this, SLOT(updateZoomFactor(float)));
 
 		connect(this->model, SIGNAL(s_modelResized(void)), this, SLOT(resizeOverview(void)));
@@ -55,7 +60,8 @@ void ModelOverviewWidget::show(ModelWidget *model)
     connect(this->model->viewport->horizontalScrollBar(), SIGNAL(valueChanged(int)), this, SLOT(resizeWindowFrame(void)));
     connect(this->model->viewport->verticalScrollBar(), SIGNAL(valueChanged(int)), this, SLOT(resizeWindowFrame(void)));
 
-		connect(this->model->scene, SIGNAL(selectionChanged(void)), this, SLOT(updateOverview(void)));
+		//Object creation, removal, movement and selection are all caught by the scene's changed() signal
+		connect(this->model->scene, SIGNAL(changed(QList<QRectF>)), this, SLOT(registerSceneChanges(QList<QRectF>)));
 		connect(this->model->scene, SIGNAL(sceneRectChanged(QRectF)),this, SLOT(resizeOverview(void)));
 		connect(this->model->scene, SIGNAL(sceneRectChanged(QRectF)),this, SLOT(updateOverview(void)));
 
@@ -74,6 +80,9 @@ void ModelOverviewWidget::show(ModelWidget *model)
 void ModelOverviewWidget::closeEvent(QCloseEvent *event)
 {
 	model=nullptr;
+	update_timer.stop();
+	dirty_rects.clear();
+	full_update=true;
 	emit s_overviewVisible(false);
 	QWidget::closeEvent(event);
 }
@@ -85,27 +94,125 @@ void ModelOverviewWidget::showEvent(QShowEvent *event)
 }
 
 void ModelOverviewWidget::updateOverview(void)
+{
+	full_update=true;
+	dirty_rects.clear();
+
+	if(this->model && this->isVisible() && !update_timer.isActive())
+		update_timer.start();
+}
+
+void ModelOverviewWidget::registerSceneChanges(const QList<QRectF> &regions)
+{
+	if(!this->model || regions.isEmpty())
+		return;
+
+	//While hidden the changes are not tracked, the whole overview is rendered again when shown
+	if(!this->isVisible())
+	{
+		full_update=true;
+		dirty_rects.clear();
+		return;
+	}
+
+	if(!full_update)
+		dirty_rects.append(regions);
+
+	/* The timer is not restarted when active so continuous changes (e.g. dragging objects)
+	still produce periodic updates instead of postponing them indefinitely */
+	if(!update_timer.isActive())
+		update_timer.start();
+}
+
+void ModelOverviewWidget::performScheduledUpdate(void)
 {
 	this->updateOverview(false);
 }
 
+void ModelOverviewWidget::renderSceneRegion(QPainter &painter, const QRectF &region)
+{
+	QRectF target, source;
+	double factor_x, factor_y;
+
+	if(scene_rect.isEmpty() || region.isEmpty())
+		return;
+
+	factor_x=curr_size.width()/scene_rect.width();
+	factor_y=curr_size.height()/scene_rect.height();
+
+	//Maps the scene region to the overview pixmap aligning it to whole pixels to avoid seams between regions
+	target=QRectF((region.left() - scene_rect.left()) * factor_x,
+								(region.top() - scene_rect.top()) * factor_y,
+								region.width() * factor_x, region.height() * factor_y).toAlignedRect();
+	target=target.intersected(QRectF(overview_pix.rect()));
+
+	if(target.isEmpty())
+		return;
+
+	//Maps back the aligned rectangle to the scene so the source and target have the same proportion
+	source=QRectF(scene_rect.left() + (target.left()/factor_x),
+								scene_rect.top() + (target.top()/factor_y),
+								target.width()/factor_x, target.height()/factor_y);
+
+	painter.save();
+	painter.setClipRect(target);
+	painter.fillRect(target, Qt::white);
+	this->model->scene->render(&painter, target, source, Qt::IgnoreAspectRatio);
+	painter.restore();
+}
+
 void ModelOverviewWidget::updateOverview(bool force_update)
 {
 	if(this->model && (this->isVisible() || force_update))
 	{
-		QPixmap pix;
-		QSize size=scene_rect.size().toSize();
+		QSize size=curr_size.toSize();
+
+		update_timer.stop();
+
+		if(size.isEmpty())
+			return;
+
+		//The pixmap is allocated only at the overview size and rendered from scratch when it's resized
+		if(overview_pix.size()!=size)
+		{
+			overview_pix=QPixmap(size);
+			full_update=true;
+		}
+
+		//Too many small regions are merged into a single one to avoid excessive render calls
+		if(!full_update && dirty_rects.size() > MAX_DIRTY_RECTS)
+		{
+			QRectF united;
 
-		//Creates a pixmap with the size of the scene
-		pix=QPixmap(size);
+			for(QRectF &rect : dirty_rects)
+				united=united.united(rect);
 
-		//Draw the scene onto the pixmap
-		QPainter p(&pix);
-		this->model->scene->render(&p, pix.rect(), scene_rect.toRect());
+			dirty_rects.clear();
+			dirty_rects.push_back(united);
+		}
+
+		if(full_update || !dirty_rects.isEmpty())
+		{
+			QPainter painter(&overview_pix);
+
+			painter.setRenderHint(QPainter::Antialiasing);
+			painter.setRenderHint(QPainter::SmoothPixmapTransform);
+
+			if(full_update)
+				renderSceneRegion(painter, scene_rect);
+			else
+			{
+				for(QRectF &rect : dirty_rects)
+					renderSceneRegion(painter, rect.intersected(scene_rect));
+			}
+
+			painter.end();
+			label->setPixmap(overview_pix);
+		}
 
-		//Resizes the pixmap to the previous configured QSize
-		label->setPixmap(pix.scaled(curr_size.toSize(), Qt::KeepAspectRatio, Qt::SmoothTransformation));
-		label->resize(curr_size.toSize());
+		label->resize(size);
+		dirty_rects.clear();
+		full_update=false;
 	}
 }
 
@@ -49,6 +49,24 @@ class ModelOverviewWidget: public QWidget, public Ui::ModelOverviewWidget {
 		//! \brief Current scene rectangle
 		QRectF scene_rect;
 
+		//! \brief Pixmap that holds the scene rendered directly at the overview size
+		QPixmap overview_pix;
+
+		//! \brief Scene regions changed since the last overview update (in scene coordinates)
+		QList<QRectF> dirty_rects;
+
+		//! \brief Indicates that the whole overview must be rendered again on the next update
+		bool full_update;
+
+		//! \brief Timer used to coalesce several scene changes into a single overview update
+		QTimer update_timer;
+
+		//! \brief Interval (in ms) in which scene changes are accumulated before updating the overview
+		static const int UPDATE_INTERVAL=100,
+
+		//! \brief Maximum amount of dirty regions rendered separately before being merged in a single region
+		MAX_DIRTY_RECTS=30;
+
 		//! \brief Resize factor applied to overview widgets (default: 20% of the scene original size)
     static constexpr float RESIZE_FACTOR=0.20f;
 
@@ -60,16 +78,23 @@ class ModelOverviewWidget: public QWidget, public Ui::ModelOverviewWidget {
 		void showEvent(QShowEvent *event);
 
 		/*! \brief Updates the overview with the last modifications on the scene. The bool parameter
-		is used to force the update even if the overview widget is not visible */
+		is used to force the update even if the overview widget is not visible. Only the regions registered
+		as dirty are rendered again unless a full update was requested */
 		void updateOverview(bool force_update);
 
+		//! \brief Renders the specified scene region onto the overview pixmap at the overview resolution
+		void renderSceneRegion(QPainter &painter, const QRectF &region);
+
 	public:
 		ModelOverviewWidget(QWidget *parent = 0);
 
 	public slots:
-		//! \brief Updates the overview (only if the widget is visible)
+		//! \brief Schedules a full update of the overview (only if the widget is visible)
 		void updateOverview(void);
 
+		//! \brief Registers the scene regions changed and schedules a partial update of the overview
+		void registerSceneChanges(const QList<QRectF> &regions);
+
 		//! \brief Resizes the frame that represents the visualization window
 		void resizeWindowFrame(void);
 
@@ -82,6 +107,10 @@ class ModelOverviewWidget: public QWidget, public Ui::ModelOverviewWidget {
 		//! \brief Shows the overview specifying the model to be drawn
 		void show(ModelWidget *model);
 
+	private slots:
+		//! \brief Performs the scheduled (coalesced) overview update
+		void performScheduledUpdate(void);
+
 	signals:
 		//! \brief Signal emitted whenever the overview window change the visibility
 		void s_overviewVisible(bool);
@@ -78,6 +78,7 @@ void ModelRestorationForm::removeTemporaryModels(void)
 	while(!file_list.isEmpty())
 	{
 		tmp_file.remove(GlobalAttributes::TEMPORARY_DIR + GlobalAttributes::DIR_SEPARATOR + file_list.front());
+		tmp_file.remove(ModelJournal::getJournalFilename(GlobalAttributes::TEMPORARY_DIR + GlobalAttributes::DIR_SEPARATOR + file_list.front()));
 		file_list.pop_front();
 	}
 }
@@ -87,6 +88,19 @@ void ModelRestorationForm::removeTemporaryModel(const QString &tmp_model)
 	QDir tmp_file;
 	QString file=QFileInfo(tmp_model).fileName();
 	tmp_file.remove(GlobalAttributes::TEMPORARY_DIR + GlobalAttributes::DIR_SEPARATOR + file);
+	tmp_file.remove(ModelJournal::getJournalFilename(GlobalAttributes::TEMPORARY_DIR + GlobalAttributes::DIR_SEPARATOR + file));
+}
+
+void ModelRestorationForm::replayJournal(const QString &tmp_model)
+{
+	try
+	{
+		ModelJournal::replayJournal(tmp_model);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
 }
 
 void ModelRestorationForm::enableRestoration(void)
@@ -28,6 +28,7 @@
 #include <QtWidgets>
 #include "hinttextwidget.h"
 #include "globalattributes.h"
+#include "modeljournal.h"
 #include "ui_modelrestorationform.h"
 
 class ModelRestorationForm: public QDialog, public Ui::ModelRestorationForm {
@@ -45,13 +46,16 @@ class ModelRestorationForm: public QDialog, public Ui::ModelRestorationForm {
 		//! \brief Returns the list of temporary files selected to be restored
 		QStringList getSelectedModels(void);
 
+		//! \brief Merges the journal of the temporary model (if exists) into the model file (see ModelJournal)
+		void replayJournal(const QString &tmp_model);
+
 	public slots:
 		int exec(void);
 
-		//! \brief Clears the tmp/ dir removing all temporary files
+		//! \brief Clears the tmp/ dir removing all temporary files (and their journals)
 		void removeTemporaryModels(void);
 
-		//! \brief Remove only the specified temp model
+		//! \brief Remove only the specified temp model and its journal
 		void removeTemporaryModel(const QString &tmp_model);
 
 		//! \brief Checks if there is at least one temporary file on tmp/ dir
@@ -398,9 +398,7 @@ void ModelsDiffHelper::generateDiffInfo(unsigned diff_type, BaseObject *object,
        !isDiffInfoExists(ObjectsDiffInfo::CREATE_OBJECT, object, nullptr))
     {
       diff_info=ObjectsDiffInfo(ObjectsDiffInfo::CREATE_OBJECT, object, nullptr);
-      diff_infos.push_back(diff_info);
-      diffs_counter[ObjectsDiffInfo::CREATE_OBJECT]++;
-      emit s_objectsDiffInfoGenerated(diff_info);
+      storeDiffInfo(diff_info);
     }
     else if(!isDiffInfoExists(diff_type, object, old_object))
     {
@@ -437,17 +435,13 @@ void ModelsDiffHelper::generateDiffInfo(unsigned diff_type, BaseObject *object,
 
         //Creates a new ALTER info with the created column
         diff_info=ObjectsDiffInfo(ObjectsDiffInfo::ALTER_OBJECT, aux_col, col);
-        diff_infos.push_back(diff_info);
-        diffs_counter[ObjectsDiffInfo::ALTER_OBJECT]++;
-        emit s_objectsDiffInfoGenerated(diff_info);
+        storeDiffInfo(diff_info);
 
         if(!reuse_sequences || imported_model->getObjectIndex(seq->getSignature(), OBJ_SEQUENCE) < 0)
         {
           //Creates a CREATE info with the sequence
           diff_info=ObjectsDiffInfo(ObjectsDiffInfo::CREATE_OBJECT, seq, nullptr);
-          diff_infos.push_back(diff_info);
-          diffs_counter[ObjectsDiffInfo::CREATE_OBJECT]++;
-          emit s_objectsDiffInfoGenerated(diff_info);
+          storeDiffInfo(diff_info);
         }
         else if(reuse_sequences)
         {
@@ -461,7 +455,7 @@ void ModelsDiffHelper::generateDiffInfo(unsigned diff_type, BaseObject *object,
                itr->getObject()->getObjectType()==OBJ_SEQUENCE &&
                itr->getObject()->getSignature()==seq->getSignature())
             {
-              diff_infos.erase(itr);
+              removeDiffInfo(itr);
               break;
             }
 
@@ -477,9 +471,7 @@ void ModelsDiffHelper::generateDiffInfo(unsigned diff_type, BaseObject *object,
       else
       {
         diff_info=ObjectsDiffInfo(diff_type, object, old_object);
-        diff_infos.push_back(diff_info);
-        diffs_counter[diff_type]++;
-        emit s_objectsDiffInfoGenerated(diff_info);
+        storeDiffInfo(diff_info);
       }
 
       /* If the info is for DROP, generate the drop for referer objects of the
@@ -500,24 +492,66 @@ void ModelsDiffHelper::generateDiffInfo(unsigned diff_type, BaseObject *object,
   }
 }
 
+void ModelsDiffHelper::storeDiffInfo(ObjectsDiffInfo &diff_info)
+{
+  unsigned diff_type=diff_info.getDiffType();
+
+  diff_infos.push_back(diff_info);
+  diffs_by_object[make_pair(diff_type, diff_info.getObject())].push_back(diff_info.getOldObject());
+
+  if(diff_info.getOldObject())
+    diffs_by_old_object[make_pair(diff_type, diff_info.getOldObject())]++;
+
+  diffs_counter[diff_type]++;
+  emit s_objectsDiffInfoGenerated(diff_info);
+}
+
+void ModelsDiffHelper::removeDiffInfo(vector<ObjectsDiffInfo>::iterator itr)
+{
+  unsigned diff_type=itr->getDiffType();
+  map<pair<unsigned, BaseObject *>, vector<BaseObject *>>::iterator obj_itr;
+  map<pair<unsigned, BaseObject *>, unsigned>::iterator old_obj_itr;
+
+  obj_itr=diffs_by_object.find(make_pair(diff_type, itr->getObject()));
+
+  if(obj_itr!=diffs_by_object.end())
+  {
+    vector<BaseObject *> &old_objs=obj_itr->second;
+    old_objs.erase(std::find(old_objs.begin(), old_objs.end(), itr->getOldObject()));
+
+    if(old_objs.empty())
+      diffs_by_object.erase(obj_itr);
+  }
+
+  old_obj_itr=diffs_by_old_object.find(make_pair(diff_type, itr->getOldObject()));
+
+  if(old_obj_itr!=diffs_by_old_object.end() && (--old_obj_itr->second)==0)
+    diffs_by_old_object.erase(old_obj_itr);
+
+  diff_infos.erase(itr);
+}
+
 bool ModelsDiffHelper::isDiffInfoExists(unsigned diff_type, BaseObject *object, BaseObject *old_object, bool exact_match)
 {
-  bool found_diff=false;
-  ObjectsDiffInfo aux_diff(diff_type, object, old_object);
+  map<pair<unsigned, BaseObject *>, vector<BaseObject *>>::iterator itr;
 
-  for(ObjectsDiffInfo diff : diff_infos)
+  if(exact_match)
   {
-    if((exact_match && diff==aux_diff) ||
-       (!exact_match &&
-         ((object && diff.getObject()==object) ||
-          (old_object && diff.getOldObject()==old_object))))
-    {
-      found_diff=true;
-      break;
-    }
+    itr=diffs_by_object.find(make_pair(diff_type, object));
+
+    return(itr!=diffs_by_object.end() &&
+           std::find(itr->second.begin(), itr->second.end(), old_object)!=itr->second.end());
+  }
+
+  //When the match is not exact any diff type is accepted for the object or old object
+  for(unsigned type=ObjectsDiffInfo::CREATE_OBJECT; type <= ObjectsDiffInfo::IGNORE_OBJECT; type++)
+  {
+    if((object && diffs_by_object.count(make_pair(type, object))) ||
+       (old_object && diffs_by_old_object.count(make_pair(type, old_object))))
+      return(true);
   }
 
-  return(found_diff);
+  return(false);
 }
 
 void ModelsDiffHelper::processDiffInfos(void)
@@ -542,7 +576,7 @@ void ModelsDiffHelper::processDiffInfos(void)
       emit s_progressUpdated(90, trUtf8("Processing diff infos..."));
 
     //Separating the base types
-    for(ObjectsDiffInfo diff : diff_infos)
+    for(ObjectsDiffInfo &diff : diff_infos)
     {
       type=dynamic_cast<Type *>(diff.getObject());
 
@@ -553,7 +587,7 @@ void ModelsDiffHelper::processDiffInfos(void)
       }
     }
 
-    for(ObjectsDiffInfo diff : diff_infos)
+    for(ObjectsDiffInfo &diff : diff_infos)
     {
       diff_type=diff.getDiffType();
       object=diff.getObject();
@@ -788,6 +822,8 @@ void ModelsDiffHelper::destroyTempObjects(void)
   }
 
   diff_infos.clear();
+  diffs_by_object.clear();
+  diffs_by_old_object.clear();
 }
 
 void ModelsDiffHelper::recreateObject(BaseObject *object, vector<BaseObject *> &drop_objs, vector<BaseObject *> &create_objs)
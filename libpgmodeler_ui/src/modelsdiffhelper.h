@@ -76,9 +76,16 @@ class ModelsDiffHelper: public QObject {
     //! brief Model which is compared to the source one
     *imported_model;
 
-    //! brief Stores all generated diff information during the process
+    //! brief Stores all generated diff information during the process (in the order they were generated)
 		vector<ObjectsDiffInfo> diff_infos;
 
+    /*! brief Indexes the diff infos by (diff type, object) storing the old objects of each info. This index
+        is used to check the existence of a diff info without scanning the whole diff_infos vector */
+    map<pair<unsigned, BaseObject *>, vector<BaseObject *>> diffs_by_object;
+
+    //! brief Indexes the diff infos by (diff type, old object) storing the amount of infos for each key
+    map<pair<unsigned, BaseObject *>, unsigned> diffs_by_old_object;
+
     //! brief Stores all temporary objects created during the diff process
     vector<BaseObject *> tmp_objects;
 
@@ -98,6 +105,12 @@ class ModelsDiffHelper: public QObject {
     //! brief Creates a diff info instance storing in o diff_infos vector
     void generateDiffInfo(unsigned diff_type, BaseObject *object, BaseObject *old_object=nullptr);
 
+    //! brief Stores the diff info in the diff_infos vector and its indexes, updates the counters and emits the signal
+    void storeDiffInfo(ObjectsDiffInfo &diff_info);
+
+    //! brief Removes the diff info pointed by the iterator from the diff_infos vector and its indexes
+    void removeDiffInfo(vector<ObjectsDiffInfo>::iterator itr);
+
     /*! brief Processes the generated diff infos resulting in a SQL buffer with the needed commands
         to synchronize both model and database */
     void processDiffInfos(void);
@@ -52,6 +52,7 @@
 #include "tagwidget.h"
 #include "eventtriggerwidget.h"
 #include "pgmodeleruins.h"
+#include "graphlayoutengine.h"
 
 vector<BaseObject *> ModelWidget::copied_objects;
 vector<BaseObject *> ModelWidget::cutted_objects;
@@ -137,6 +138,7 @@ ModelWidget::ModelWidget(QWidget *parent) : QWidget(parent)
 	db_model=new DatabaseModel;
 	xmlparser=db_model->getXMLParser();
 	op_list=new OperationList(db_model);
+	tmp_journal=new ModelJournal(db_model, tmp_filename);
 	scene=new ObjectsScene;
 	scene->setSceneRect(QRectF(0,0,2000,2000));
 
@@ -374,6 +376,7 @@ ModelWidget::~ModelWidget(void)
 	delete(viewport);
 	delete(scene);
 	delete(op_list);
+	delete(tmp_journal);
 	delete(db_model);
 }
 
@@ -1093,7 +1096,11 @@ void ModelWidget::loadModel(const QString &filename)
 		task_prog_wgt.setWindowTitle(trUtf8("Loading database model"));
 		task_prog_wgt.show();
 
+    //The objects' graphical representation is created in bulk mode and configured once at the end
+    scene->startBulkInsertion();
     db_model->loadModel(filename);
+    scene->finishBulkInsertion();
+
     this->filename=filename;
     this->adjustSceneSize();
 
@@ -1103,6 +1110,7 @@ void ModelWidget::loadModel(const QString &filename)
 	}
 	catch(Exception &e)
 	{
+		scene->finishBulkInsertion();
 		task_prog_wgt.close();
 		this->modified=false;
 		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
@@ -1323,6 +1331,11 @@ QString ModelWidget::getTempFilename(void)
 	return(this->tmp_filename);
 }
 
+void ModelWidget::saveTemporaryModel(void)
+{
+	tmp_journal->saveModel();
+}
+
 void ModelWidget::showObjectForm(ObjectType obj_type, BaseObject *object, BaseObject *parent_obj, QPointF pos)
 {
 	try
@@ -3546,105 +3559,13 @@ void ModelWidget::removeRelationshipPoints(void)
 
 void ModelWidget::rearrangeSchemas(QPointF origin, unsigned tabs_per_row, unsigned sch_per_row, float obj_spacing)
 {
-	vector<BaseObject *>::iterator itr, itr_end;
-	Schema *schema=nullptr;
-	SchemaView *sch_view=nullptr;
-	unsigned sch_id=0;
-	float x=origin.x(), y=origin.y(), max_y=-1, cy=0;
-
-	itr=db_model->getObjectList(OBJ_SCHEMA)->begin();
-	itr_end=db_model->getObjectList(OBJ_SCHEMA)->end();
-
-	while(itr!=itr_end)
-	{
-		schema=dynamic_cast<Schema *>(*itr);
-
-		/* Forcing the schema rectangle to be visible in order to correctly positioin
-			 schemas over the screen */
-		schema->setRectVisible(true);
-
-		sch_view=dynamic_cast<SchemaView *>(schema->getReceiverObject());
-		schema->setModified(true);
-
-		//The schema is processed only there are tables inside of it
-    if(sch_view && sch_view->getChildrenCount() > 0)
-		{
-			//Organizing the tables inside the schema
-			rearrangeTables(schema, QPointF(x,y), tabs_per_row, obj_spacing);
-			schema->setModified(true);
-
-			cy=sch_view->pos().y() + sch_view->boundingRect().height();
-
-			//Defining the maximum y position to avoid schema boxes colliding vertically
-			if(max_y < cy)
-				max_y=cy;
-
-			sch_id++;
-
-			//It the current schema is the last of it`s row
-			if(sch_id >= sch_per_row)
-			{
-				//Incrementing the row position
-				sch_id=0;
-				y=max_y + obj_spacing;
-				x=origin.x();
-				max_y=-1;
-			}
-			else
-				//Configuring the x position for the next schema on the current row
-				x=sch_view->pos().x() + sch_view->boundingRect().width() + obj_spacing;
-		}
+	GraphLayoutEngine layout_eng;
 
-		itr++;
-	}
+	layout_eng.setTablesPerRow(tabs_per_row);
+	layout_eng.setSchemasPerRow(sch_per_row);
+	layout_eng.setObjectSpacing(obj_spacing);
+	layout_eng.rearrangeObjects(db_model, origin);
 
 	//Adjust the whole scene size due to table/schema repositioning
 	this->adjustSceneSize();
 }
-
-void ModelWidget::rearrangeTables(Schema *schema, QPointF origin, unsigned tabs_per_row, float obj_spacing)
-{
-	if(schema)
-	{
-		vector<BaseObject *> tables, views;
-		vector<BaseObject *>::iterator itr;
-		BaseTableView *tab_view=nullptr;
-		BaseTable *base_tab=nullptr;
-		unsigned tab_id=0;
-		float max_y=-1, x=origin.x(), y=origin.y(), cy=0;
-
-		//Get the tables and views for the specified schema
-		tables=db_model->getObjects(OBJ_TABLE, schema);
-		views=db_model->getObjects(OBJ_VIEW, schema);
-		tables.insert(tables.end(), views.begin(), views.end());
-
-		itr=tables.begin();
-		while(itr!=tables.end())
-		{
-			base_tab=dynamic_cast<BaseTable *>(*itr);
-			tab_view=dynamic_cast<BaseTableView *>(base_tab->getReceiverObject());			
-			tab_view->setPos(QPointF(x,y));
-
-			//Defining the maximum y position to avoid table boxes colliding vertically
-			cy=tab_view->pos().y()  + tab_view->boundingRect().bottomRight().y();
-			if(max_y < cy)
-				max_y=cy;
-
-			//It the current table is the last of it's row
-			tab_id++;
-			if(tab_id >= tabs_per_row)
-			{
-				//Incrementing the row position
-				tab_id=0;
-				y=max_y + obj_spacing;
-				x=origin.x();
-				max_y=-1;
-			}
-			else
-				//Configuring the x position for the next table on the current row
-				x=tab_view->pos().x() + tab_view->boundingRect().width() + obj_spacing;
-
-			itr++;
-		}
-	}
-}
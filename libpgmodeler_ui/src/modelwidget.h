@@ -28,6 +28,7 @@
 #include <QtWidgets>
 #include "databasemodel.h"
 #include "operationlist.h"
+#include "modeljournal.h"
 #include "messagebox.h"
 #include "baseform.h"
 #include "objectsscene.h"
@@ -114,6 +115,9 @@ class ModelWidget: public QWidget {
 		//! \brief Database model handle by the ModelWidget class. All operations are made over this attribute
 		DatabaseModel *db_model;
 
+		//! \brief Journal used to incrementally save the model on the temporary file
+		ModelJournal *tmp_journal;
+
 		//! \brief Stores the loaded database model filename
 		QString filename,
 
@@ -186,15 +190,10 @@ class ModelWidget: public QWidget {
 		//! \brief Disables the model actions when some new object action is active
 		void enableModelActions(bool value);
 
-		/*! \brief Reorganizes the schemas over the scene. The parameters are: an origin point,
-		number of tables per row, schemas per row and a object spacing */
+		/*! \brief Reorganizes the schemas and their tables over the scene using the relationships graph (see GraphLayoutEngine).
+		The parameters are: an origin point, number of tables (without relationships) per row, schemas per row and a object spacing */
 		void rearrangeSchemas(QPointF origin, unsigned tabs_per_row, unsigned sch_per_row, float obj_spacing);
 
-		/*! \brief Reorganizes the tables of a specific schema over the scene. The parameter are:
-		 the schema in which the tables will be rearranged, an origin point, number of tables per row
-		 a object spacing */
-		void rearrangeTables(Schema *schema, QPointF origin, unsigned tabs_per_row, float obj_spacing);
-
 	public:
     static constexpr float MINIMUM_ZOOM=0.05f,
 													 MAXIMUM_ZOOM=4.0f,
@@ -212,6 +211,9 @@ class ModelWidget: public QWidget {
 		//! \brief Returns the temporary (security copy) of the currently loaded model
 		QString getTempFilename(void);
 
+		//! \brief Saves the model on the temporary file writing only the changes since the last saving when possible
+		void saveTemporaryModel(void);
+
 		//! \brief Shows the editing form according to the passed object type
 		void showObjectForm(ObjectType obj_type, BaseObject *object=nullptr, BaseObject *parent_obj=nullptr, QPointF pos=QPointF(NAN, NAN));
 
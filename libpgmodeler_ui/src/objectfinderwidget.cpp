@@ -107,7 +107,8 @@ void ObjectFinderWidget::findObjects(void)
 
 		//Search the objects on model
 		objs=model_wgt->getDatabaseModel()->findObjects(pattern_edt->text(), types, true,
-																										case_sensitive_chk->isChecked(), regexp_chk->isChecked(), exact_match_chk->isChecked());
+																										case_sensitive_chk->isChecked(), regexp_chk->isChecked(), exact_match_chk->isChecked(),
+																										search_defs_chk->isChecked());
 
 		//Show the found objects on the result table
 		updateObjectTable(result_tbw, objs);
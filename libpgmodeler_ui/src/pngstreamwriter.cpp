@@ -0,0 +1,214 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2015 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+#include "pngstreamwriter.h"
+#include "exception.h"
+
+PNGStreamWriter::PNGStreamWriter(void)
+{
+	width=height=rows_written=0;
+	zstream_init=false;
+}
+
+PNGStreamWriter::~PNGStreamWriter(void)
+{
+	releaseStream();
+}
+
+void PNGStreamWriter::releaseStream(void)
+{
+	if(zstream_init)
+	{
+		deflateEnd(&zstream);
+		zstream_init=false;
+	}
+}
+
+void PNGStreamWriter::raiseWriteError(void)
+{
+	QString filename=output.fileName();
+
+	releaseStream();
+	output.close();
+	output.remove();
+
+	throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_WRITTEN).arg(filename),
+									ERR_FILE_DIR_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+}
+
+void PNGStreamWriter::writeChunk(const char *type, const QByteArray &data)
+{
+	QByteArray header;
+	quint32 crc=0, size=data.size();
+	char crc_buf[4];
+
+	header.append(static_cast<char>((size >> 24) & 0xff));
+	header.append(static_cast<char>((size >> 16) & 0xff));
+	header.append(static_cast<char>((size >> 8) & 0xff));
+	header.append(static_cast<char>(size & 0xff));
+	header.append(type, 4);
+
+	//The CRC is calculated over the chunk type and data
+	crc=crc32(0, reinterpret_cast<const Bytef *>(type), 4);
+	crc=crc32(crc, reinterpret_cast<const Bytef *>(data.constData()), data.size());
+
+	crc_buf[0]=static_cast<char>((crc >> 24) & 0xff);
+	crc_buf[1]=static_cast<char>((crc >> 16) & 0xff);
+	crc_buf[2]=static_cast<char>((crc >> 8) & 0xff);
+	crc_buf[3]=static_cast<char>(crc & 0xff);
+
+	if(output.write(header)!=header.size() ||
+		 output.write(data)!=data.size() ||
+		 output.write(crc_buf, 4)!=4)
+		raiseWriteError();
+}
+
+void PNGStreamWriter::deflateData(const QByteArray &data, int flush)
+{
+	int size=0;
+
+	zstream.next_in=reinterpret_cast<Bytef *>(const_cast<char *>(data.constData()));
+	zstream.avail_in=data.size();
+
+	/* The compressor is called until it stops filling the whole output buffer, which means that all the
+		 input was consumed (or, when finishing, that the stream ended). Each output produced is written as
+		 an IDAT chunk so only one buffer of compressed data is kept in memory */
+	do
+	{
+		zstream.next_out=reinterpret_cast<Bytef *>(zbuffer.data());
+		zstream.avail_out=zbuffer.size();
+
+		if(deflate(&zstream, flush)==Z_STREAM_ERROR)
+			raiseWriteError();
+
+		size=zbuffer.size() - zstream.avail_out;
+
+		if(size > 0)
+			writeChunk("IDAT", zbuffer.left(size));
+	}
+	while(zstream.avail_out==0);
+}
+
+void PNGStreamWriter::open(const QString &filename, unsigned width, unsigned height)
+{
+	QByteArray ihdr;
+	const char signature[]={ '\x89', 'P', 'N', 'G', '\r', '\n', '\x1a', '\n' };
+
+	output.setFileName(filename);
+	releaseStream();
+
+	//Empty images can't be represented in PNG format
+	if(width!=0 && height!=0)
+		output.open(QFile::WriteOnly | QFile::Truncate);
+
+	if(!output.isOpen())
+		throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_WRITTEN).arg(filename),
+										ERR_FILE_DIR_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	this->width=width;
+	this->height=height;
+	rows_written=0;
+	rows_buf.clear();
+	zbuffer.resize(OUTPUT_BUFFER_SIZE);
+
+	zstream.zalloc=Z_NULL;
+	zstream.zfree=Z_NULL;
+	zstream.opaque=Z_NULL;
+
+	if(deflateInit(&zstream, Z_DEFAULT_COMPRESSION)!=Z_OK)
+		raiseWriteError();
+
+	zstream_init=true;
+
+	if(output.write(signature, sizeof(signature))!=sizeof(signature))
+		raiseWriteError();
+
+	//IHDR: width, height, bit depth 8, color type 2 (RGB), default compression, filter and no interlace
+	for(unsigned value : { width, height })
+	{
+		ihdr.append(static_cast<char>((value >> 24) & 0xff));
+		ihdr.append(static_cast<char>((value >> 16) & 0xff));
+		ihdr.append(static_cast<char>((value >> 8) & 0xff));
+		ihdr.append(static_cast<char>(value & 0xff));
+	}
+
+	ihdr.append(static_cast<char>(8));
+	ihdr.append(static_cast<char>(2));
+	ihdr.append(3, '\0');
+	writeChunk("IHDR", ihdr);
+}
+
+void PNGStreamWriter::writeRows(const QImage &image, unsigned rows)
+{
+	const QRgb *scanline=nullptr;
+	char *pixel=nullptr;
+	int row_size=(width * 3) + 1;
+
+	if(!output.isOpen())
+		throw Exception(ERR_OPR_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	if(static_cast<unsigned>(image.width())!=width || rows > static_cast<unsigned>(image.height()) ||
+		 rows_written + rows > height ||
+		 (image.format()!=QImage::Format_RGB32 && image.format()!=QImage::Format_ARGB32))
+		raiseWriteError();
+
+	//The filtered rows of the band are compressed together
+	rows_buf.resize(row_size * rows);
+	pixel=rows_buf.data();
+
+	for(unsigned row=0; row < rows; row++)
+	{
+		scanline=reinterpret_cast<const QRgb *>(image.constScanLine(row));
+
+		//Each row starts with its filter type (0 = none)
+		*pixel++='\0';
+
+		for(unsigned col=0; col < width; col++)
+		{
+			*pixel++=static_cast<char>(qRed(scanline[col]));
+			*pixel++=static_cast<char>(qGreen(scanline[col]));
+			*pixel++=static_cast<char>(qBlue(scanline[col]));
+		}
+	}
+
+	deflateData(rows_buf, Z_NO_FLUSH);
+	rows_written+=rows;
+}
+
+void PNGStreamWriter::close(void)
+{
+	if(!output.isOpen())
+		return;
+
+	if(rows_written!=height)
+		raiseWriteError();
+
+	//Finishes the deflate stream writing the remaining compressed data and the Adler-32 checksum
+	deflateData(QByteArray(), Z_FINISH);
+	releaseStream();
+	rows_buf.clear();
+	zbuffer.clear();
+
+	writeChunk("IEND", QByteArray());
+
+	if(!output.flush())
+		raiseWriteError();
+
+	output.close();
+}
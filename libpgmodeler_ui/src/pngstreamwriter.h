@@ -0,0 +1,92 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2015 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+/**
+\ingroup libpgmodeler_ui
+\class PNGStreamWriter
+\brief Implements a minimal PNG encoder that compresses and writes the image rows to the file as soon as
+they are provided, this way images larger than the available memory can be generated band by band.
+\note The pixel data is compressed with zlib in a single deflate stream that is flushed to IDAT chunks
+as the compressor output grows. Images that fit in memory should be saved through QImage::save().
+*/
+
+#ifndef PNG_STREAM_WRITER_H
+#define PNG_STREAM_WRITER_H
+
+#include <QFile>
+#include <QImage>
+#include <zlib.h>
+
+class PNGStreamWriter {
+	private:
+		//! \brief Size of the buffer that receives the compressed data (each full buffer is written as an IDAT chunk)
+		static const int OUTPUT_BUFFER_SIZE=65536;
+
+		//! \brief Output file
+		QFile output;
+
+		//! \brief Image dimensions
+		unsigned width, height,
+
+		//! \brief Amount of rows already written
+		rows_written;
+
+		//! \brief Compression stream of the pixel data
+		z_stream zstream;
+
+		//! \brief Indicates that the compression stream was initialized and must be released
+		bool zstream_init;
+
+		//! \brief Filtered rows of the band being compressed
+		QByteArray rows_buf;
+
+		//! \brief Receives the compressed data before it's written to the file
+		QByteArray zbuffer;
+
+		//! \brief Writes a PNG chunk to the file
+		void writeChunk(const char *type, const QByteArray &data);
+
+		/*! \brief Compresses the data using the provided flush mode (Z_NO_FLUSH or Z_FINISH) writing the
+		compressed output in IDAT chunks. When finishing, all the remaining output is written */
+		void deflateData(const QByteArray &data, int flush);
+
+		//! \brief Releases the compression stream (if initialized)
+		void releaseStream(void);
+
+		//! \brief Raises an error related to the writing of the output file
+		void raiseWriteError(void);
+
+	public:
+		PNGStreamWriter(void);
+		~PNGStreamWriter(void);
+
+		/*! \brief Creates the file and writes the PNG header for an RGB image with the provided dimensions.
+		Raises an error if the file can't be created */
+		void open(const QString &filename, unsigned width, unsigned height);
+
+		/*! \brief Writes the first 'rows' rows of the image (which must have the same width of the PNG image and
+		the format QImage::Format_RGB32 or QImage::Format_ARGB32). The alpha channel is ignored */
+		void writeRows(const QImage &image, unsigned rows);
+
+		/*! \brief Finishes the PNG file. Raises an error if the amount of rows written
+		differs from the image height or the file can't be written */
+		void close(void);
+};
+
+#endif
@@ -37,123 +37,142 @@
 class SyntaxHighlighter: public QSyntaxHighlighter {
 	private:
 		Q_OBJECT
-		XMLParser xmlparser;
 
-		//! \brief Auxiliary class used by the highlighter that stores informations	about multiline code blocks
-		class MultiLineInfo: public QTextBlockUserData {
+		/*! \brief Stores a set of expressions of a group compiled for fast matching. The fixed strings
+		(when the group isn't partial match) are stored in hash sets so a word is checked with a single lookup
+		instead of being compared against each expression */
+		class ExpressionSet {
 			public:
-				//! \brief Column where starts the multiline info
-				int start_col,
+				//! \brief Case sensitive fixed strings
+				QSet<QString> keywords,
 
-						//! \brief Block (line) where the multiline starts
-						start_block,
+				//! \brief Case insensitive fixed strings (stored case folded)
+				ci_keywords;
 
-						/*! \brief Column where the multiline info ends it can be -1 while the
-						highlighter does not find the multiline end char */
-						end_col,
+				//! \brief Expressions that can't be matched through the hash sets (in the same order of the configuration)
+				vector<QRegExp> exprs;
+		};
+
+		//! \brief Stores the compiled rules of a group
+		class GroupRules {
+			public:
+				//! \brief Name of the group
+				QString name;
 
-						/*! \brief Block (line) where the multiline info ends it can be -1 while
-						the highlighter does not find the multiline end char */
-						end_block;
+				//! \brief Compiled initial and final expressions
+				ExpressionSet initial_exprs, final_exprs;
 
-				//! \brief Highlight group used to highlight the matching words on multiline
-				QString group;
+				//! \brief Text format of the group
+				QTextCharFormat format;
 
-				MultiLineInfo(void)
+				//! \brief Indicates that the group uses partial matching
+				bool partial_match;
+
+				//! \brief Char that breaks the highlight for a group (null when not defined)
+				QChar lookahead_char;
+
+				GroupRules(void)
 				{
-					this->group=QString();
-					this->start_col=-1;
-					this->start_block=-1;
-					this->end_col=-1;
-					this->end_block=-1;
+					partial_match=false;
 				}
 		};
 
-		static QFont default_font;
+		/*! \brief Stores the compiled form of a highlight configuration file. Each file is parsed only once
+		and the resulting configuration is shared (read only) by all the highlighters that loaded it */
+		class HighlightConfig {
+			public:
+				/*! \brief Stores the regexp used to identify keywords, identifiers, strings, numbers.
+				Also stores initial regexps used to identify a multiline group */
+				map<QString, vector<QRegExp> > initial_exprs;
 
-		/*! \brief Stores the multiline infos and is used to check if the text being typed
-		by the user is on a multiline block */
-		vector<MultiLineInfo *> multi_line_infos;
+				/*! \brief Stores the regexps that indicates the end of a group. This regexps are
+				used mainly to identify the end of multiline comments */
+				map<QString, vector<QRegExp> > final_exprs;
 
-		/*! \brief Stores the regexp used to identify keywords, identifiers, strings, numbers.
-		Also stores initial regexps used to identify a multiline group */
-		map<QString, vector<QRegExp> > initial_exprs;
+				//! \brief Stores the text formatting to each group
+				map<QString, QTextCharFormat> formats;
 
-		/*! \brief Stores the regexps that indicates the end of a group. This regexps are
-		used mainly to identify the end of multiline comments */
-		map<QString, vector<QRegExp> > final_exprs;
+				//! \brief Stores the groups related to partial matching
+				map<QString, bool> partial_match;
 
-		//! \brief Stores the text formatting to each group
-		map<QString, QTextCharFormat> formats;
+				//! \brief Stores the char used to break the highlight for a group. This char is not highlighted itself.
+				map<QString, QChar> lookahead_char;
 
-		//! \brief Stores the groups related to partial matching
-		map<QString, bool> partial_match;
+				//! \brief Stores the order in which the groups must be applied
+				vector<QString> groups_order;
 
-		//! \brief Stores the char used to break the highlight for a group. This char is not highlighted itself.
-		map<QString, QChar> lookahead_char;
+				//! \brief Stores the chars that indicates word separators
+				QString word_separators,
 
-		//! \brief Stores the order in which the groups must be applied
-		vector<QString> groups_order;
+								//! \brief Stores the chars that indicates word delimiters
+								word_delimiters,
 
-		//! \brief Indicates if the configuration is loaded or not
-		bool conf_loaded,
+								//! \brief Stores the chars ignored by the highlighter during the word reading
+								ignored_chars;
 
-					/*! \brief Indicates that the code must be rehighlighted in real time (as the user types).
-					If this attribute is set to false, the user must always call the rehighlight method */
-					auto_rehighlight,
+				//! \brief Stores the char that triggers the code completion
+				QChar	completion_trigger;
 
-					/*! \brief This causes the highlighter to ignores any RETURN/ENTER press on QTextEdit causing
-							the text to be in a single line. */
-					single_line_mode;
+				//! \brief Modification date of the file when it was parsed (used to detect changes on the file)
+				QDateTime last_modified;
 
-		//! \brief Stores the chars that indicates word separators
-		QString word_separators,
+				//! \brief Compiled rules of the groups in the order they must be applied
+				vector<GroupRules> rules;
+		};
 
-						//! \brief Stores the chars that indicates word delimiters
-						word_delimiters,
+		static QFont default_font;
 
-						//! \brief Stores the chars ignored by the highlighter during the word reading
-						ignored_chars;
+		//! \brief Stores the configurations already loaded (the key is the file name)
+		static map<QString, HighlightConfig> loaded_confs;
 
-		//! \brief Stores the char that triggers the code completion
-		QChar	completion_trigger;
+		//! \brief Empty configuration used by the highlighters which have no configuration loaded
+		static const HighlightConfig empty_conf;
 
-		//! \brief Current block in which the highlighter is positioned
-		int current_block;
+		//! \brief Configuration in use by the highlighter (points to an element of loaded_confs or to empty_conf)
+		const HighlightConfig *conf;
 
-		/*! \brief Multiline info count on the current block. This attribute is used to know when
-		the highlighter must call the rehighlight method to highlight all the document again */
-		unsigned curr_blk_info_count;
+		//! \brief Indicates if the configuration is loaded or not
+		bool conf_loaded,
+
+					/*! \brief This causes the highlighter to ignores any RETURN/ENTER press on QTextEdit causing
+							the text to be in a single line. */
+					single_line_mode;
 
 		//! \brief Configures the initial attributes of the highlighter
 		void configureAttributes(void);
 
-		/*! \brief Indentifies the group which the word belongs to.  The other parameters indicates, respectively,
-		the lookahead char for the group, the current index (column) on the buffer, the initial match indixe and the
-		match length. */
-		QString identifyWordGroup(const QString &palavra, const QChar &lookahead_chr, int idx, int &match_idx, int &match_len);
+		//! \brief Parses the highlight configuration file storing the result in the provided configuration
+		static void parseConfiguration(const QString &filename, HighlightConfig &config);
+
+		//! \brief Builds the compiled rules of the configuration from the parsed groups
+		static void compileConfiguration(HighlightConfig &config);
 
-		/*! \brief Returns the multiline info for the specified start and end column and for the specified block.
-		Returns null when no such info could be found. */
-		MultiLineInfo *getMultiLineInfo(int col_ini, int end_col, int block);
+		//! \brief Splits the expressions between the hash sets and the regexp list of the expression set
+		static void compileExpressions(const vector<QRegExp> &exprs, bool partial_match, ExpressionSet &expr_set);
 
-		//! \brief Removes the multiline info for the specified block index
-		void removeMultiLineInfo(int block);
+		/*! \brief Tries to match the word against the expression set. The folded_word is the case folded version of the word
+		used to check the case insensitive keywords. The match_idx and match_len receives the matched portion of the word */
+		static bool matchExpressions(const ExpressionSet &expr_set, bool partial_match, const QString &word,
+																 const QString &folded_word, int &match_idx, int &match_len);
 
-		//! \brief Returns the multiline info count for the specified block
-		unsigned getMultiLineInfoCount(int block);
+		/*! \brief Indentifies the group (index in the compiled rules) which the word belongs to returning -1 if no group matches.
+		The other parameters indicates, respectively, the lookahead char for the group, the initial match index, the match length and
+		the multiline group that is open at the word's position (-1 if none). This last one is updated when the word opens or closes
+		a multiline group */
+		int identifyWordGroup(const QString &word, const QChar &lookahead_chr, int &match_idx, int &match_len, int &open_group);
 
 		/*! \brief This event filter is used to nullify the line breaks when the highlighter
 		 is created in single line edit model */
 		bool eventFilter(QObject *object, QEvent *event);
 
 	public:
-		/*! \brief Install the syntax highlighter in a QTextEdit. The boolean param is used to
-		enable the auto rehighlight. If this is set to false the user must call the rehighlight method
-		every time he modifies the text */
+		/*! \brief Install the syntax highlighter in a QTextEdit. Since the multiline groups open at the end of each
+		block are stored in the block's state only the modified blocks (and the following ones whose state changed) are
+		highlighted again, this way the auto_rehighlight param is not used anymore and is kept only for compatibility */
 		SyntaxHighlighter(QTextEdit *parent, bool auto_rehighlight, bool single_line_mode=false);
 
-		//! \brief Loads a highlight configuration from a XML file
+		/*! \brief Loads a highlight configuration from a XML file. The file is parsed only in the first time
+		it is loaded (or when it was modified since then), otherwise the already compiled configuration is reused */
 		void loadConfiguration(const QString &filename);
 
 		//! \brief Returns if the configuration were successfully loaded
@@ -166,21 +185,14 @@ class SyntaxHighlighter: public QSyntaxHighlighter {
 		//! \brief Returns the current configured code completion trigger char
 		QChar getCompletionTrigger(void);
 
+		//! \brief Defines the font used by the highlighters updating the formats of the already loaded configurations
 		static void setDefaultFont(const QFont &fnt);
 
-	public slots:
-		//! \brief Rehighlight all the document
-		void rehighlight(void);
-
 	private slots:
-		//! \brief Highlight a line of the text
+		/*! \brief Highlight a line of the text. The block state stores the index (plus one) of the
+		multiline group that remains open at the end of the block (zero when none) */
 		void highlightBlock(const QString &txt);
 
-		/*! \brief Validates the text modification made by the user doing the highlight if needed.
-		This slot is linked with the contentsChanged() of document because is in it that are
-		captured the character count removed and added on the text */
-		void validateTextModification(int, int removed, int added);
-
 		//! \brief Clears the loaded configuration
 		void clearConfiguration(void);
 };
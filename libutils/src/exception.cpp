@@ -256,11 +256,9 @@ Exception::Exception(const QString &msg, const QString &method, const QString &f
 
 Exception::Exception(ErrorType error_type, const QString &method, const QString &file, int line, Exception *exception, const QString &extra_info)
 {
-	/* Because the Exception class is not derived from QObject the function tr() is inefficient to translate messages
-		so the translation method is called  directly from the application specifying the
-		context (Exception) in the ts file and the text to be translated */
-	configureException(QApplication::translate("Exception",messages[error_type][ERROR_MESSAGE].toStdString().c_str(),"", -1),
-										 error_type, method, file, line, extra_info);
+	//The message translation is deferred until the message is requested (see getErrorMessage())
+	configureException(QString(), error_type, method, file, line, extra_info);
+	deferred_msg=true;
 
 	if(exception) addException(*exception);
 }
@@ -275,11 +273,9 @@ Exception::Exception(ErrorType error_type, const QString &method, const QString
 {
 	vector<Exception>::iterator itr, itr_end;
 
-	/* Because the Exception class is not derived from QObject the function tr() is inefficient to translate messages
-		so the translation method is called  directly from the application specifying the
-		context (Exception) in the ts file and the text to be translated */
-	configureException(QApplication::translate("Exception",messages[error_type][ERROR_MESSAGE].toStdString().c_str(),"",-1),
-										 error_type, method, file, line, extra_info);
+	//The message translation is deferred until the message is requested (see getErrorMessage())
+	configureException(QString(), error_type, method, file, line, extra_info);
+	deferred_msg=true;
 
 	itr=exceptions.begin();
 	itr_end=exceptions.end();
@@ -326,10 +322,17 @@ void Exception::configureException(const QString &msg, ErrorType error_type, con
 	this->file=file;
 	this->line=line;
 	this->extra_info=QString(extra_info);
+	this->deferred_msg=false;
 }
 
 QString Exception::getErrorMessage(void)
 {
+	if(deferred_msg)
+	{
+		error_msg=getErrorMessage(error_type);
+		deferred_msg=false;
+	}
+
 	return(error_msg);
 }
 
@@ -379,27 +382,24 @@ QString Exception::getExtraInfo(void)
 
 void Exception::addException(Exception &exception)
 {
-	vector<Exception>::iterator itr, itr_end;
+	/* The copy shares the nested exceptions of the added one (the strings are implicitly shared too)
+	so the cost of chaining doesn't depend on the depth of the exception stack */
+	this->exceptions.push_back(make_shared<Exception>(exception));
+}
 
-	itr=exception.exceptions.begin();
-	itr_end=exception.exceptions.end();
+void Exception::appendExceptions(vector<Exception> &list)
+{
+	for(auto &exception : this->exceptions)
+		exception->appendExceptions(list);
 
-	while(itr!=itr_end)
-	{
-		this->exceptions.push_back(Exception(itr->error_msg,itr->error_type,
-																					itr->method,itr->file,itr->line,nullptr,itr->extra_info));
-		itr++;
-	}
-	exception.exceptions.clear();
-	this->exceptions.push_back(Exception(exception.error_msg,exception.error_type,
-																			 exception.method,exception.file,exception.line,nullptr,exception.extra_info));
+	list.push_back(*this);
+	list.back().exceptions.clear();
 }
 
 void Exception::getExceptionsList(vector<Exception> &list)
 {
-	list.assign(this->exceptions.begin(), this->exceptions.end());
-	list.push_back(Exception(this->error_msg,this->error_type,
-													 this->method,this->file,this->line,nullptr,this->extra_info));
+	list.clear();
+	appendExceptions(list);
 }
 
 QString Exception::getExceptionsText(void)
@@ -31,6 +31,7 @@
 #include <signal.h>
 #include <vector>
 #include <deque>
+#include <memory>
 
 using namespace std;
 
@@ -277,8 +278,10 @@ class Exception {
 	private:
 
 		/*! \brief Stores other exceptions before raise the 'this' exception.
-		 This structure can be used to simulate a stack trace to improve the debug */
-		vector<Exception> exceptions;
+		 This structure can be used to simulate a stack trace to improve the debug.
+		 The nested exceptions are shared (each one holding its own nested list) so chaining an exception
+		 on a rethrow copies only the caught exception's attributes instead of the whole stack */
+		vector<shared_ptr<Exception>> exceptions;
 
 		//! \brief Stores the error messages and codes (names of errors) in string format
 		static QString messages[ERROR_COUNT][2];
@@ -308,12 +311,19 @@ class Exception {
 		//! \brief Line of file where the exception were generated (Macro __LINE__)
 		int line;
 
+		/*! \brief Indicates that the error message is the (not yet translated) default message of the error type.
+		The translation is done only when the message is requested (see getErrorMessage()) */
+		bool deferred_msg;
+
 		//! \brief Configures the basic attributes of exception
 		void configureException(const QString &msg, ErrorType error_type, const QString &method, const QString &file, int line, const QString &extra_info);
 
 		//! \brief Adds a exception to the list of exceptions
 		void addException(Exception &exception);
 
+		//! \brief Appends to the list the nested exceptions (recursively) followed by the 'this' exception without its nested list
+		void appendExceptions(vector<Exception> &list);
+
 	public:
 		Exception(void);
     Exception(const QString &msg, const QString &method, const QString &file, int line, Exception *exception=nullptr, const QString &extra_info=QString());
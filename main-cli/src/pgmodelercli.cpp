@@ -23,6 +23,8 @@ const QString PgModelerCLI::INPUT=QString("--input");
 const QString PgModelerCLI::OUTPUT=QString("--output");
 const QString PgModelerCLI::EXPORT_TO_FILE=QString("--export-to-file");
 const QString PgModelerCLI::EXPORT_TO_PNG=QString("--export-to-png");
+const QString PgModelerCLI::EXPORT_TO_SVG=QString("--export-to-svg");
+const QString PgModelerCLI::EXPORT_TO_PDF=QString("--export-to-pdf");
 const QString PgModelerCLI::EXPORT_TO_DBMS=QString("--export-to-dbms");
 const QString PgModelerCLI::DROP_DATABASE=QString("--drop-database");
 const QString PgModelerCLI::DROP_OBJECTS=QString("--drop-objects");
@@ -45,6 +47,8 @@ const QString PgModelerCLI::FIX_MODEL=QString("--fix-model");
 const QString PgModelerCLI::FIX_TRIES=QString("--fix-tries");
 const QString PgModelerCLI::ZOOM_FACTOR=QString("--zoom");
 const QString PgModelerCLI::USE_TMP_NAMES=QString("--use-tmp-names");
+const QString PgModelerCLI::REARRANGE_OBJS=QString("--rearrange");
+const QString PgModelerCLI::MEMORY_REPORT=QString("--memory-report");
 
 PgModelerCLI::PgModelerCLI(int argc, char **argv) :  QApplication(argc, argv)
 {
@@ -110,8 +114,8 @@ PgModelerCLI::PgModelerCLI(int argc, char **argv) :  QApplication(argc, argv)
 			xmlparser=model->getXMLParser();
 			silent_mode=(parsed_opts.count(SILENT));
 
-			//If the export is to png image loads additional configurations
-			if(parsed_opts.count(EXPORT_TO_PNG))
+			//If the export is to png, svg or pdf loads additional configurations
+			if(parsed_opts.count(EXPORT_TO_PNG) || parsed_opts.count(EXPORT_TO_SVG) || parsed_opts.count(EXPORT_TO_PDF))
 			{
 				connect(model, SIGNAL(s_objectAdded(BaseObject*)), this, SLOT(handleObjectAddition(BaseObject *)));
 
@@ -171,6 +175,8 @@ void PgModelerCLI::initializeOptions(void)
 	long_opts[OUTPUT]=true;
 	long_opts[EXPORT_TO_FILE]=false;
 	long_opts[EXPORT_TO_PNG]=false;
+	long_opts[EXPORT_TO_SVG]=false;
+	long_opts[EXPORT_TO_PDF]=false;
 	long_opts[EXPORT_TO_DBMS]=false;
 	long_opts[DROP_DATABASE]=false;
   long_opts[DROP_OBJECTS]=false;
@@ -192,11 +198,15 @@ void PgModelerCLI::initializeOptions(void)
 	long_opts[FIX_TRIES]=true;
 	long_opts[ZOOM_FACTOR]=true;
   long_opts[USE_TMP_NAMES]=false;
+  long_opts[REARRANGE_OBJS]=false;
+  long_opts[MEMORY_REPORT]=false;
 
   short_opts[INPUT]=QString("-i");
   short_opts[OUTPUT]=QString("-o");
   short_opts[EXPORT_TO_FILE]=QString("-f");
   short_opts[EXPORT_TO_PNG]=QString("-p");
+  short_opts[EXPORT_TO_SVG]=QString("-G");
+  short_opts[EXPORT_TO_PDF]=QString("-O");
   short_opts[EXPORT_TO_DBMS]=QString("-d");
   short_opts[DROP_DATABASE]=QString("-T");
   short_opts[DROP_OBJECTS]=QString("-J");
@@ -219,6 +229,8 @@ void PgModelerCLI::initializeOptions(void)
   short_opts[FIX_TRIES]=QString("-t");
   short_opts[ZOOM_FACTOR]=QString("-z");
   short_opts[USE_TMP_NAMES]=QString("-n");
+  short_opts[REARRANGE_OBJS]=QString("-r");
+  short_opts[MEMORY_REPORT]=QString("-M");
 }
 
 bool PgModelerCLI::isOptionRecognized(QString &op, bool &accepts_val)
@@ -251,22 +263,27 @@ accepted structure. All available options are described below.") << endl;
 	out << endl;
 	out << trUtf8("General options: ") << endl;
 	out << trUtf8("   %1, %2=[FILE]\t\t Input model file (.dbm). Mandatory use when fixing a model or exporting it.").arg(short_opts[INPUT]).arg(INPUT) << endl;
-	out << trUtf8("   %1, %2=[FILE]\t\t Output file. Mandatory use when fixing model or export to file or png.").arg(short_opts[OUTPUT]).arg(OUTPUT) << endl;
+	out << trUtf8("   %1, %2=[FILE]\t\t Output file. Mandatory use when fixing model or export to file, png, svg or pdf.").arg(short_opts[OUTPUT]).arg(OUTPUT) << endl;
   out << trUtf8("   %1, %2\t\t Try to fix the structure of the input model file in order to make it loadable again.").arg(short_opts[FIX_MODEL]).arg(FIX_MODEL) << endl;
 	out << trUtf8("   %1, %2\t\t Model fix tries. When reaching the maximum count the invalid objects will be discard.").arg(short_opts[FIX_TRIES]).arg(FIX_TRIES) << endl;
+	out << trUtf8("   %1, %2\t\t Shows the memory footprint saved by each object type of the input model.").arg(short_opts[MEMORY_REPORT]).arg(MEMORY_REPORT) << endl;
 	out << trUtf8("   %1, %2\t\t Export to a sql script file.").arg(short_opts[EXPORT_TO_FILE]).arg(EXPORT_TO_FILE)<< endl;
 	out << trUtf8("   %1, %2\t\t Export to a png image.").arg(short_opts[EXPORT_TO_PNG]).arg(EXPORT_TO_PNG) << endl;
+	out << trUtf8("   %1, %2\t\t Export to a svg (vector) image.").arg(short_opts[EXPORT_TO_SVG]).arg(EXPORT_TO_SVG) << endl;
+	out << trUtf8("   %1, %2\t\t Export to a pdf (vector) document.").arg(short_opts[EXPORT_TO_PDF]).arg(EXPORT_TO_PDF) << endl;
 	out << trUtf8("   %1, %2\t\t Export directly to a PostgreSQL server.").arg(short_opts[EXPORT_TO_DBMS]).arg(EXPORT_TO_DBMS) << endl;
 	out << trUtf8("   %1, %2\t\t List available connections on %3 file.").arg(short_opts[LIST_CONNS]).arg(LIST_CONNS).arg(GlobalAttributes::CONNECTIONS_CONF + GlobalAttributes::CONFIGURATION_EXT) << endl;
 	out << trUtf8("   %1, %2\t\t Version of generated SQL code. Only for file or dbms export.").arg(short_opts[PGSQL_VER]).arg(PGSQL_VER) << endl;
 	out << trUtf8("   %1, %2\t\t\t Silent execution. Only critical errors are shown during process.").arg(short_opts[SILENT]).arg(SILENT) << endl;
 	out << trUtf8("   %1, %2\t\t\t Show this help menu.").arg(short_opts[HELP]).arg(HELP) << endl;
 	out << endl;
-	out << trUtf8("PNG export options: ") << endl;
-	out << trUtf8("   %1, %2\t\t Draws the grid on the exported png image.").arg(short_opts[SHOW_GRID]).arg(SHOW_GRID) << endl;
-	out << trUtf8("   %1, %2\t Draws the page delimiters on the exported png image.").arg(short_opts[SHOW_DELIMITERS]).arg(SHOW_DELIMITERS) << endl;
-  out << trUtf8("   %1, %2\t\t Each page will be exported on a separated png image.").arg(short_opts[PAGE_BY_PAGE]).arg(PAGE_BY_PAGE) << endl;
+	out << trUtf8("PNG, SVG and PDF export options: ") << endl;
+	out << trUtf8("   %1, %2\t\t Draws the grid on the exported image.").arg(short_opts[SHOW_GRID]).arg(SHOW_GRID) << endl;
+	out << trUtf8("   %1, %2\t Draws the page delimiters on the exported image.").arg(short_opts[SHOW_DELIMITERS]).arg(SHOW_DELIMITERS) << endl;
+  out << trUtf8("   %1, %2\t\t Each page will be exported on a separated png/svg image or pdf page.").arg(short_opts[PAGE_BY_PAGE]).arg(PAGE_BY_PAGE) << endl;
   out << trUtf8("   %1, %2=[FACTOR]\t\t Applies a zoom (in percent) before export to png image. Accepted zoom interval: %3-%4").arg(short_opts[ZOOM_FACTOR]).arg(ZOOM_FACTOR).arg(ModelWidget::MINIMUM_ZOOM*100).arg(ModelWidget::MAXIMUM_ZOOM*100) << endl;
+  out << trUtf8("   %1, %2\t\t Rearranges tables and views based upon the relationships before export to image.").arg(short_opts[REARRANGE_OBJS]).arg(REARRANGE_OBJS) << endl;
+  out << trUtf8("   Note: the image exports can be run without a display by setting the environment variable QT_QPA_PLATFORM=offscreen.") << endl;
 	out << endl;
 	out << trUtf8("DBMS export options: ") << endl;
 	out << trUtf8("   %1, %2\t Ignores errors related to duplicated objects that eventually exists on server side.").arg(short_opts[IGNORE_DUPLICATES]).arg(IGNORE_DUPLICATES) << endl;
@@ -322,26 +339,31 @@ void PgModelerCLI::parseOptions(attribs_map &opts)
 	else
 	{
 		int mode_cnt=0;
-    bool fix_model=(opts.count(FIX_MODEL) > 0);
+    bool fix_model=(opts.count(FIX_MODEL) > 0),
+        mem_report=(opts.count(MEMORY_REPORT) > 0);
     QFileInfo input_fi(opts[INPUT]), output_fi(opts[OUTPUT]);
 
 		//Checking if multiples export modes were specified
 		mode_cnt+=opts.count(EXPORT_TO_FILE);
 		mode_cnt+=opts.count(EXPORT_TO_PNG);
+		mode_cnt+=opts.count(EXPORT_TO_SVG);
+		mode_cnt+=opts.count(EXPORT_TO_PDF);
 		mode_cnt+=opts.count(EXPORT_TO_DBMS);
 
 		if(opts.count(ZOOM_FACTOR))
 			zoom=opts[ZOOM_FACTOR].toFloat()/static_cast<float>(100);
 
-    if(!fix_model && mode_cnt==0)
+    if(!fix_model && !mem_report && mode_cnt==0)
 			throw Exception(trUtf8("No export mode specified!"), ERR_CUSTOM,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+    else if(mem_report && (fix_model || mode_cnt > 0))
+			throw Exception(trUtf8("The memory report can't be combined with model fixing or export!"), ERR_CUSTOM,__PRETTY_FUNCTION__,__FILE__,__LINE__);
     else if(!fix_model && mode_cnt > 1)
 			throw Exception(trUtf8("Multiple export mode especified!"), ERR_CUSTOM,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		else	if(opts[INPUT].isEmpty())
 			throw Exception(trUtf8("No input file specified!"), ERR_CUSTOM,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-		else	if(!opts.count(EXPORT_TO_DBMS) && opts[OUTPUT].isEmpty())
+		else	if(!opts.count(EXPORT_TO_DBMS) && !mem_report && opts[OUTPUT].isEmpty())
 			throw Exception(trUtf8("No output file specified!"), ERR_CUSTOM,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-    else if(!opts.count(EXPORT_TO_DBMS) && input_fi.absoluteFilePath()==output_fi.absoluteFilePath())
+    else if(!opts.count(EXPORT_TO_DBMS) && !mem_report && input_fi.absoluteFilePath()==output_fi.absoluteFilePath())
 			throw Exception(trUtf8("Input file must be different from output!"), ERR_CUSTOM,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		else if(opts.count(EXPORT_TO_DBMS) && !opts.count(CONN_ALIAS) &&
 						 (!opts.count(HOST) || !opts.count(USER) || !opts.count(PASSWD) || !opts.count(INITIAL_DB)) )
@@ -373,6 +395,8 @@ int PgModelerCLI::exec(void)
 
 				if(parsed_opts.count(FIX_MODEL))
 					out << trUtf8("Starting model fixing...") << endl;
+				else if(parsed_opts.count(MEMORY_REPORT))
+					out << trUtf8("Starting memory report...") << endl;
 				else
 					out << trUtf8("Starting model export...") << endl;
 
@@ -392,24 +416,77 @@ int PgModelerCLI::exec(void)
 				if(!silent_mode)
 					out << trUtf8("Model successfully fixed!") << endl << endl;
 			}
+			else if(parsed_opts.count(MEMORY_REPORT))
+			{
+				model->createSystemObjects(false);
+				model->loadModel(parsed_opts[INPUT]);
+
+				/* Generating the code of the whole model makes each object release its attributes
+					 thus all the attributes used by the object types are considered on the report */
+				model->getCodeDefinition(SchemaParser::XML_DEFINITION);
+				model->getCodeDefinition(SchemaParser::SQL_DEFINITION);
+
+				showMemoryReport();
+			}
 			else
 			{
 				//Create the systems objects on model before loading it
 				model->createSystemObjects(false);
 
-				//Load the model file
+				//Load the model file (the scene, when used, is populated in bulk mode)
+				if(scene) scene->startBulkInsertion();
 				model->loadModel(parsed_opts[INPUT]);
+				if(scene) scene->finishBulkInsertion();
 
-				//Export to PNG
-				if(parsed_opts.count(EXPORT_TO_PNG))
+				//Export to PNG, SVG or PDF
+				if(scene)
 				{
-					if(!silent_mode)
-						out << trUtf8("Export to PNG image: ") << parsed_opts[OUTPUT] << endl;
+					if(parsed_opts.count(REARRANGE_OBJS))
+					{
+						GraphLayoutEngine layout_eng;
+						QRectF rect;
+
+						if(!silent_mode)
+							out << trUtf8("Rearranging objects...") << endl;
+
+						layout_eng.rearrangeObjects(model, QPointF(50, 50));
+
+						//Resizing the scene to the new objects' extent
+						rect=scene->itemsBoundingRect();
+						rect.setTopLeft(QPointF(0,0));
+						scene->setSceneRect(rect);
+					}
+
+					if(parsed_opts.count(EXPORT_TO_SVG))
+					{
+						if(!silent_mode)
+							out << trUtf8("Export to SVG image: ") << parsed_opts[OUTPUT] << endl;
+
+						export_hlp.exportToSVG(scene, parsed_opts[OUTPUT],
+																	 parsed_opts.count(SHOW_GRID) > 0,
+																	 parsed_opts.count(SHOW_DELIMITERS) > 0,
+																	 parsed_opts.count(PAGE_BY_PAGE) > 0);
+					}
+					else if(parsed_opts.count(EXPORT_TO_PDF))
+					{
+						if(!silent_mode)
+							out << trUtf8("Export to PDF document: ") << parsed_opts[OUTPUT] << endl;
 
-					export_hlp.exportToPNG(scene, parsed_opts[OUTPUT], zoom,
-																 parsed_opts.count(SHOW_GRID) > 0,
-                                 parsed_opts.count(SHOW_DELIMITERS) > 0,
-                                 parsed_opts.count(PAGE_BY_PAGE) > 0);
+						export_hlp.exportToPDF(scene, parsed_opts[OUTPUT],
+																	 parsed_opts.count(SHOW_GRID) > 0,
+																	 parsed_opts.count(SHOW_DELIMITERS) > 0,
+																	 parsed_opts.count(PAGE_BY_PAGE) > 0);
+					}
+					else
+					{
+						if(!silent_mode)
+							out << trUtf8("Export to PNG image: ") << parsed_opts[OUTPUT] << endl;
+
+						export_hlp.exportToPNG(scene, parsed_opts[OUTPUT], zoom,
+																	 parsed_opts.count(SHOW_GRID) > 0,
+																	 parsed_opts.count(SHOW_DELIMITERS) > 0,
+																	 parsed_opts.count(PAGE_BY_PAGE) > 0);
+					}
 				}
 				//Export to SQL file
 				else if(parsed_opts.count(EXPORT_TO_FILE))
@@ -446,6 +523,29 @@ int PgModelerCLI::exec(void)
 	}
 }
 
+void PgModelerCLI::showMemoryReport(void)
+{
+	map<ObjectType, unsigned> counts=model->getObjectCountByType();
+	unsigned long long obj_size=0, type_total=0, total=0;
+
+	out << endl << trUtf8("Memory saved between code generations (type : objects x bytes per object = total bytes)") << endl;
+
+	for(auto &itr : counts)
+	{
+		if(itr.second==0)
+			continue;
+
+		obj_size=BaseObject::getSavedMemoryPerObject(itr.first);
+		type_total=obj_size * itr.second;
+		total+=type_total;
+
+		out << QString("   ") << BaseObject::getTypeName(itr.first) << QString(" : ") << itr.second
+				<< QString(" x ") << obj_size << QString(" = ") << type_total << endl;
+	}
+
+	out << trUtf8("Total: %1 KB").arg(total/1024) << endl << endl;
+}
+
 void PgModelerCLI::updateProgress(int progress, QString msg)
 {
 	if(progress > 0)
@@ -611,11 +711,8 @@ void PgModelerCLI::extractObjectXML(void)
 
 void PgModelerCLI::recreateObjects(void)
 {
-	QStringList fail_objs, constr, list;
+	QStringList fail_objs, constr;
 	QString xml_def;
-	BaseObject *object=nullptr;
-  ObjectType obj_type=BASE_OBJECT;
-	attribs_map attribs;
 	bool use_fail_obj=false;
 	unsigned tries=0, max_tries=parsed_opts[FIX_TRIES].toUInt();
 
@@ -643,57 +740,11 @@ void PgModelerCLI::recreateObjects(void)
 			fixObjectAttributes(xml_def);
 		}
 
-		try
-		{
-			xmlparser->restartParser();
-			xmlparser->loadXMLBuffer(xml_def);
-      obj_type=BaseObject::getObjectType(xmlparser->getElementName());
-
-			xmlparser->getElementAttributes(attribs);
-
-			if(obj_type==OBJ_DATABASE)
-				model->configureDatabase(attribs);
-			else
-			{
-				if(obj_type==OBJ_TABLE)
-				{
-					//Before create a table extract it's foreign keys
-					list=extractForeignKeys(xml_def);
-
-					/* If fks were extracted insert them on the main constraints list
-					and restarts the XMLParser with the modified buffer */
-					if(!list.isEmpty())
-					{
-						constr.append(list);
-						xmlparser->restartParser();
-						xmlparser->loadXMLBuffer(xml_def);
-					}
-				}
-
-				//Discarding fk relationships
-				if(obj_type!=OBJ_RELATIONSHIP ||
-					 (obj_type==OBJ_RELATIONSHIP && !xml_def.contains(QString("\"%1\"").arg(ParsersAttributes::RELATIONSHIP_FK))))
-				{
-					object=model->createObject(obj_type);
-
-					if(object)
-					{
-						if(!dynamic_cast<TableObject *>(object) && obj_type!=OBJ_RELATIONSHIP && obj_type!=BASE_RELATIONSHIP)
-							model->addObject(object);
-					}
-
-					//For each sucessful created object the method will try to create a failed one
-					use_fail_obj=(!fail_objs.isEmpty());
-				}
-			}
-		}
-		catch(Exception &e)
-		{
-			if(obj_type!=OBJ_DATABASE)
-				fail_objs.push_back(xml_def);
-			else
-				throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
-		}
+		//For each sucessful created object the method will try to create a failed one
+		if(recreateObject(xml_def, constr))
+			use_fail_obj=(!fail_objs.isEmpty());
+		else
+			fail_objs.push_back(xml_def);
 
 		if(objs_xml.isEmpty() && (!fail_objs.isEmpty() || !constr.isEmpty()))
 		{
@@ -727,6 +778,66 @@ void PgModelerCLI::recreateObjects(void)
 	}
 }
 
+bool PgModelerCLI::recreateObject(QString &xml_def, QStringList &constr)
+{
+	BaseObject *object=nullptr;
+	ObjectType obj_type=BASE_OBJECT;
+	attribs_map attribs;
+	QStringList list;
+
+	try
+	{
+		xmlparser->restartParser();
+		xmlparser->loadXMLBuffer(xml_def);
+		obj_type=BaseObject::getObjectType(xmlparser->getElementName());
+
+		xmlparser->getElementAttributes(attribs);
+
+		if(obj_type==OBJ_DATABASE)
+			model->configureDatabase(attribs);
+		else
+		{
+			if(obj_type==OBJ_TABLE)
+			{
+				//Before create a table extract it's foreign keys
+				list=extractForeignKeys(xml_def);
+
+				/* If fks were extracted insert them on the main constraints list
+				and restarts the XMLParser with the modified buffer */
+				if(!list.isEmpty())
+				{
+					constr.append(list);
+					xmlparser->restartParser();
+					xmlparser->loadXMLBuffer(xml_def);
+				}
+			}
+
+			//Discarding fk relationships
+			if(obj_type!=OBJ_RELATIONSHIP ||
+				 (obj_type==OBJ_RELATIONSHIP && !xml_def.contains(QString("\"%1\"").arg(ParsersAttributes::RELATIONSHIP_FK))))
+			{
+				object=model->createObject(obj_type);
+
+				if(object)
+				{
+					if(!dynamic_cast<TableObject *>(object) && obj_type!=OBJ_RELATIONSHIP && obj_type!=BASE_RELATIONSHIP)
+						model->addObject(object);
+				}
+			}
+		}
+
+		return(true);
+	}
+	catch(Exception &e)
+	{
+		//The failed objects are retried later so only the errors on the database configuration are raised
+		if(obj_type==OBJ_DATABASE)
+			throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+
+		return(false);
+	}
+}
+
 void PgModelerCLI::fixObjectAttributes(QString &obj_xml)
 {
   QString tag=QString("<%1"), end_tag=QString("</%1"),
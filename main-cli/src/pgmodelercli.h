@@ -34,6 +34,7 @@
 #include "modelexporthelper.h"
 #include "generalconfigwidget.h"
 #include "connectionsconfigwidget.h"
+#include "graphlayoutengine.h"
 
 class PgModelerCLI: public QApplication {
 	private:
@@ -47,7 +48,7 @@ class PgModelerCLI: public QApplication {
 		//! \brief Reference database model
 		DatabaseModel *model;
 
-		//! \brief Graphical scene used to export the model to png
+		//! \brief Graphical scene used to export the model to png, svg or pdf
 		ObjectsScene *scene;
 
 		//! \brief Stores the configured connection
@@ -85,6 +86,8 @@ class PgModelerCLI: public QApplication {
 		OUTPUT,
 		EXPORT_TO_FILE,
 		EXPORT_TO_PNG,
+		EXPORT_TO_SVG,
+		EXPORT_TO_PDF,
 		EXPORT_TO_DBMS,
 		DROP_DATABASE,
     DROP_OBJECTS,
@@ -106,7 +109,9 @@ class PgModelerCLI: public QApplication {
 		FIX_MODEL,
 		FIX_TRIES,
     ZOOM_FACTOR,
-    USE_TMP_NAMES;
+    USE_TMP_NAMES,
+    REARRANGE_OBJS,
+    MEMORY_REPORT;
 
 		//! \brief Parsers the options and executes the action specified by them
 		void parseOptions(attribs_map &parsed_opts);
@@ -127,6 +132,15 @@ class PgModelerCLI: public QApplication {
 		//! \brief Recreates the objects from the obj_xml list fixing the creation order for them
 		void recreateObjects(void);
 
+		/*! \brief Recreates the object from its xml code. The foreign keys extracted from tables are appended to the
+		constraints list. Returns false when the object couldn't be created (an exception is raised only when the
+		database itself can't be configured) so the frequent failures of this process don't raise exceptions */
+		bool recreateObject(QString &xml_def, QStringList &constr);
+
+		/*! \brief Shows, for each object type, the amount of objects in the model and the estimated memory
+		that isn't kept allocated by them between the code generations (see BaseObject::getSavedMemoryPerObject()) */
+		void showMemoryReport(void);
+
 		//! \brief Fix some xml attributes and remove unused tags
 		void fixObjectAttributes(QString &obj_xml);
 
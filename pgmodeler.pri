@@ -141,7 +141,7 @@ DEFINES += BINDIR=\\\"$${BINDIR}\\\" \
            TEMPDIR=\\\"$${TEMPDIR}\\\"
 
 
-# pgModeler depends on libpq and libxml2 this way to variables
+# pgModeler depends on libpq, libxml2 and zlib this way to variables
 # are define so the compiler can find the libs at link time.
 #
 # PGSQL_LIB -> Full path to libpq.(so | dll | dylib)
@@ -149,12 +149,16 @@ DEFINES += BINDIR=\\\"$${BINDIR}\\\" \
 #
 # XML_LIB   -> Full path to libxml2.(so | dll | dylib)
 # XML_INC   -> Root path where XML2 includes can be found
+#
+# ZLIB_LIB  -> Full path to zlib.(so | dll | dylib) (already a dependency of libxml2)
+# ZLIB_INC  -> Root path where zlib includes can be found
 
 unix:!macx {
   CONFIG += link_pkgconfig
-  PKGCONFIG = libpq libxml-2.0
+  PKGCONFIG = libpq libxml-2.0 zlib
   PGSQL_LIB = -lpq
   XML_LIB = -lxml2
+  ZLIB_LIB = -lz
 }
 
 macx {
@@ -162,8 +166,10 @@ macx {
   PGSQL_INC = /Library/PostgreSQL/9.3/include
   XML_INC = /Applications/Xcode.app/Contents/Developer/Platforms/MacOSX.platform/Developer/SDKs/MacOSX10.9.sdk/usr/include/libxml2
   XML_LIB = /Applications/Xcode.app/Contents/Developer/Platforms/MacOSX.platform/Developer/SDKs/MacOSX10.9.sdk/usr/lib/libxml2.dylib
+  ZLIB_INC = /Applications/Xcode.app/Contents/Developer/Platforms/MacOSX.platform/Developer/SDKs/MacOSX10.9.sdk/usr/include
+  ZLIB_LIB = /Applications/Xcode.app/Contents/Developer/Platforms/MacOSX.platform/Developer/SDKs/MacOSX10.9.sdk/usr/lib/libz.dylib
 
-  INCLUDEPATH += $$PGSQL_INC $$XML_INC
+  INCLUDEPATH += $$PGSQL_INC $$XML_INC $$ZLIB_INC
 }
 
 windows {
@@ -171,11 +177,13 @@ windows {
   PGSQL_INC = C:/PostgreSQL/9.3/include
   XML_INC = C:/Qt/Qt5.4.0/5.4/mingw491_32/include
   XML_LIB = C:/Qt/Qt5.4.0/5.4/mingw491_32/bin/libxml2-2.dll
+  ZLIB_INC = C:/Qt/Qt5.4.0/5.4/mingw491_32/include
+  ZLIB_LIB = C:/Qt/Qt5.4.0/5.4/mingw491_32/bin/zlib1.dll
 
   # Workaround to solve bug of timespec struct on MingW + PostgreSQL < 9.4
   QMAKE_CXXFLAGS+="-DHAVE_STRUCT_TIMESPEC"
 
-  INCLUDEPATH += $$PGSQL_INC $$XML_INC
+  INCLUDEPATH += $$PGSQL_INC $$XML_INC $$ZLIB_INC
 }
 
 macx | windows {
@@ -203,6 +211,18 @@ macx | windows {
     VALUE = $$XML_INC
   }
 
+  !exists($$ZLIB_LIB) {
+    PKG_ERROR = "zlib libraries"
+    VARIABLE = "ZLIB_LIB"
+    VALUE = $$ZLIB_LIB
+  }
+
+  !exists($$ZLIB_INC/zlib.h) {
+    PKG_ERROR = "zlib headers"
+    VARIABLE = "ZLIB_INC"
+    VALUE = $$ZLIB_INC
+  }
+
   !isEmpty(PKG_ERROR) {
     warning("$$PKG_ERROR were not found at \"$$VALUE\"!")
     warning("Please correct the value of $$VARIABLE and try again!")
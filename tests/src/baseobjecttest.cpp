@@ -0,0 +1,115 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2015 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "baseobjecttest.h"
+
+//! \brief Exposes the modes of the schema parser shared by the objects on the current thread
+class SchemaParserProbe: public Schema {
+	public:
+		static bool isParserStrict(void)
+		{
+			return(!schparser.isIgnoringUnkownAttributes() && !schparser.isIgnoringEmptyAttributes());
+		}
+
+		//! \brief Returns the amount of objects being generated on the current thread
+		static unsigned getGenerationDepth(void)
+		{
+			return(code_gen_stack.size());
+		}
+};
+
+void BaseObjectTest::restoresSchemaParserModes(void)
+{
+	Schema schema, other;
+
+	try
+	{
+		schema.setName(QString("test_schema"));
+		schema.setComment(QString("comment"));
+		other.setName(QString("test_schema"));
+
+		/* Comments, DROP and ALTER commands are generated ignoring unknown/empty attributes. The parser is shared
+		by all the objects so these modes must not remain enabled otherwise the objects validation (which expects
+		errors for undefined attributes) is disabled for the next generations */
+		schema.getCodeDefinition(SchemaParser::SQL_DEFINITION);
+		QVERIFY(SchemaParserProbe::isParserStrict());
+
+		schema.getCodeDefinition(SchemaParser::XML_DEFINITION);
+		QVERIFY(SchemaParserProbe::isParserStrict());
+
+		schema.getDropDefinition(true);
+		QVERIFY(SchemaParserProbe::isParserStrict());
+
+		schema.getAlterDefinition(&other);
+		QVERIFY(SchemaParserProbe::isParserStrict());
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void BaseObjectTest::tracksCodeDependencies(void)
+{
+	DatabaseModel model;
+	Schema *schema=new Schema;
+	Table *table=new Table;
+	Column *column=new Column;
+	Rule rule;
+	bool aborted=false;
+
+	try
+	{
+		model.createSystemObjects(true);
+
+		schema->setName(QString("test_schema"));
+		model.addSchema(schema);
+
+		column->setName(QString("id"));
+		column->setType(PgSQLType(QString("integer")));
+		table->setName(QString("test_table"));
+		table->setSchema(schema);
+		table->addColumn(column);
+		model.addTable(table);
+
+		//The schema name used in the table code is registered as a dependency once the generation finishes
+		QVERIFY(table->getCodeDefinition(SchemaParser::SQL_DEFINITION).contains(QString("test_schema.test_table")));
+		QCOMPARE(SchemaParserProbe::getGenerationDepth(), 0u);
+
+		schema->setName(QString("renamed_schema"));
+		QVERIFY(table->isCodeInvalidated());
+		QVERIFY(table->getCodeDefinition(SchemaParser::SQL_DEFINITION).contains(QString("renamed_schema.test_table")));
+
+		//A rule without a table can't be generated, the aborted generation must leave the stack anyway
+		try
+		{
+			rule.getCodeDefinition(SchemaParser::SQL_DEFINITION);
+		}
+		catch(Exception &)
+		{
+			aborted=true;
+		}
+
+		QVERIFY(aborted);
+		QCOMPARE(SchemaParserProbe::getGenerationDepth(), 0u);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
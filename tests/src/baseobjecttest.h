@@ -0,0 +1,40 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2015 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup tests
+\class BaseObjectTest
+\brief Checks the code generation state shared by the model objects
+*/
+
+#ifndef BASE_OBJECT_TEST_H
+#define BASE_OBJECT_TEST_H
+
+#include <QtTest>
+#include "databasemodel.h"
+
+class BaseObjectTest: public QObject {
+	private:
+		Q_OBJECT
+
+	private slots:
+		void restoresSchemaParserModes(void);
+		void tracksCodeDependencies(void);
+};
+
+#endif
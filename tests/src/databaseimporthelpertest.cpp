@@ -0,0 +1,123 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2015 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "databaseimporthelpertest.h"
+
+const QString DatabaseImportHelperTest::TEST_DB_NAME=QString("pgmodeler_import_test");
+
+void DatabaseImportHelperTest::initTestCase(void)
+{
+	QString host=qgetenv("PGMODELER_TEST_HOST"), port=qgetenv("PGMODELER_TEST_PORT"),
+			user=qgetenv("PGMODELER_TEST_USER"), passwd=qgetenv("PGMODELER_TEST_PASSWORD"),
+			dbname=qgetenv("PGMODELER_TEST_DB");
+
+	if(host.isEmpty())
+		QSKIP("PGMODELER_TEST_HOST isn't set, no server available to import from");
+
+	conn.setConnectionParam(Connection::PARAM_SERVER_FQDN, host);
+	conn.setConnectionParam(Connection::PARAM_PORT, port.isEmpty() ? QString("5432") : port);
+	conn.setConnectionParam(Connection::PARAM_USER, user.isEmpty() ? QString("postgres") : user);
+	conn.setConnectionParam(Connection::PARAM_PASSWORD, passwd);
+	conn.setConnectionParam(Connection::PARAM_DB_NAME, dbname.isEmpty() ? QString("postgres") : dbname);
+}
+
+void DatabaseImportHelperTest::cleanupTestCase(void)
+{
+	if(!conn.getConnectionParam(Connection::PARAM_SERVER_FQDN).isEmpty())
+		dropTestDatabase();
+}
+
+void DatabaseImportHelperTest::dropTestDatabase(void)
+{
+	Connection aux_conn=conn;
+
+	aux_conn.connect();
+	aux_conn.executeDDLCommand(QString("DROP DATABASE IF EXISTS %1").arg(TEST_DB_NAME));
+	aux_conn.close();
+}
+
+void DatabaseImportHelperTest::importDatabase(const QStringList &cmds, DatabaseModel &model)
+{
+	Connection db_conn=conn;
+	DatabaseImportHelper import_helper;
+	Catalog catalog;
+	attribs_map db_attribs;
+	map<ObjectType, vector<unsigned>> obj_oids;
+	map<unsigned, vector<unsigned>> col_oids;
+
+	dropTestDatabase();
+	db_conn.connect();
+	db_conn.executeDDLCommand(QString("CREATE DATABASE %1").arg(TEST_DB_NAME));
+	db_conn.switchToDatabase(TEST_DB_NAME);
+
+	for(const QString &cmd : cmds)
+		db_conn.executeDDLCommand(cmd);
+
+	catalog.setConnection(db_conn);
+	catalog.setFilter(Catalog::LIST_ALL_OBJS | Catalog::EXCL_BUILTIN_ARRAY_TYPES |
+										Catalog::EXCL_EXTENSION_OBJS | Catalog::EXCL_SYSTEM_OBJS);
+	catalog.getObjectsOIDs(obj_oids, col_oids, {{ParsersAttributes::FILTER_TABLE_TYPES, ParsersAttributes::_TRUE_}});
+
+	import_helper.setConnection(db_conn);
+	import_helper.setCurrentDatabase(TEST_DB_NAME);
+	db_attribs=import_helper.getObjects(OBJ_DATABASE);
+
+	for(auto &itr : db_attribs)
+	{
+		if(itr.second==TEST_DB_NAME)
+			obj_oids[OBJ_DATABASE].push_back(itr.first.toUInt());
+	}
+
+	model.createSystemObjects(true);
+	import_helper.setSelectedOIDs(&model, obj_oids, col_oids);
+	import_helper.setImportOptions(false, false, true, false, false, false);
+	import_helper.importDatabase();
+	import_helper.closeConnection();
+	db_conn.close();
+}
+
+void DatabaseImportHelperTest::createsSerialSequenceBeforeTable(void)
+{
+	DatabaseModel model;
+	Sequence *seq=nullptr;
+	Table *tab=nullptr;
+	QString sql;
+
+	try
+	{
+		/* The sequence of a serial column has a lower oid than the table and the table's default depends on it
+		while the sequence is owned by the table's column (OWNED BY) */
+		importDatabase({ QString("CREATE TABLE public.serial_tab (id serial PRIMARY KEY, name text)") }, model);
+
+		seq=model.getSequence(QString("public.serial_tab_id_seq"));
+		tab=model.getTable(QString("public.serial_tab"));
+
+		QVERIFY(seq!=nullptr);
+		QVERIFY(tab!=nullptr);
+		QVERIFY(seq->getObjectId() < tab->getObjectId());
+
+		//The table's default value (nextval) must not reference a sequence not created yet
+		sql=model.getCodeDefinition(SchemaParser::SQL_DEFINITION);
+		QVERIFY(sql.indexOf(QString("CREATE SEQUENCE")) >= 0);
+		QVERIFY(sql.indexOf(QString("CREATE SEQUENCE")) < sql.indexOf(QString("CREATE TABLE")));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
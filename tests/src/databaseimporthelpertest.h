@@ -0,0 +1,57 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2015 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup tests
+\class DatabaseImportHelperTest
+\brief Imports databases created on a PostgreSQL server and checks the generated models.
+\note The server is configured through the environment variables PGMODELER_TEST_HOST, PGMODELER_TEST_PORT,
+PGMODELER_TEST_USER, PGMODELER_TEST_PASSWORD and PGMODELER_TEST_DB (maintenance database). The tests
+are skipped when PGMODELER_TEST_HOST isn't set. The user must be able to create databases.
+*/
+
+#ifndef DATABASE_IMPORT_HELPER_TEST_H
+#define DATABASE_IMPORT_HELPER_TEST_H
+
+#include <QtTest>
+#include "databaseimporthelper.h"
+
+class DatabaseImportHelperTest: public QObject {
+	private:
+		Q_OBJECT
+
+		//! \brief Name of the database created by the tests
+		static const QString TEST_DB_NAME;
+
+		//! \brief Connection to the maintenance database
+		Connection conn;
+
+		/*! \brief Creates the test database running the commands on it and imports the
+		whole database into the provided model */
+		void importDatabase(const QStringList &cmds, DatabaseModel &model);
+
+		//! \brief Drops the test database (if exists)
+		void dropTestDatabase(void);
+
+	private slots:
+		void initTestCase(void);
+		void cleanupTestCase(void);
+		void createsSerialSequenceBeforeTable(void);
+};
+
+#endif
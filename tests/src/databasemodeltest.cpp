@@ -0,0 +1,84 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2015 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "databasemodeltest.h"
+
+void DatabaseModelTest::createModel(DatabaseModel &model)
+{
+	Tablespace *tabspc=new Tablespace;
+	Table *table=new Table;
+	Column *column=new Column;
+
+	model.setName(QString("test_db"));
+	model.createSystemObjects(true);
+
+	tabspc->setName(QString("test_tabspc"));
+	tabspc->setDirectory(QString("/tmp/test_tabspc"));
+	model.addTablespace(tabspc);
+
+	column->setName(QString("id"));
+	column->setType(PgSQLType(QString("integer")));
+
+	table->setName(QString("test_table"));
+	table->setSchema(model.getSchema(QString("public")));
+	table->addColumn(column);
+	model.addTable(table);
+}
+
+void DatabaseModelTest::reusesCreationOrderAcrossExports(void)
+{
+	DatabaseModel model;
+	Column *column=nullptr;
+	map<unsigned, BaseObject *> order;
+	unsigned long long mod_id=0;
+	unsigned global_id=0;
+
+	try
+	{
+		createModel(model);
+
+		//The first export computes and stores the creation order
+		model.getCodeDefinition(SchemaParser::SQL_DEFINITION);
+		order=model.getCreationOrder(SchemaParser::SQL_DEFINITION);
+		mod_id=BaseObject::getGlobalModificationId();
+		global_id=BaseObject::getGlobalId();
+
+		/* The stored order is reused while the counters used to detect changes stay the same. Generating the SQL
+		of the whole model (which comments out the database and tablespaces) must not change them */
+		model.getCodeDefinition(SchemaParser::SQL_DEFINITION);
+		QCOMPARE(BaseObject::getGlobalModificationId(), mod_id);
+		QCOMPARE(BaseObject::getGlobalId(), global_id);
+		QVERIFY(model.getCreationOrder(SchemaParser::SQL_DEFINITION)==order);
+
+		//The database and the tablespace are still commented out in the generated code
+		QVERIFY(model.getCodeDefinition(SchemaParser::SQL_DEFINITION).contains(QString("-- CREATE TABLESPACE")));
+		QVERIFY(model.getCodeDefinition(SchemaParser::SQL_DEFINITION).contains(QString("-- CREATE DATABASE")));
+		QVERIFY(!model.isSQLDisabled());
+
+		//Any change on the model computes the order again
+		column=new Column;
+		column->setName(QString("name"));
+		column->setType(PgSQLType(QString("text")));
+		model.getTable(QString("public.test_table"))->addColumn(column);
+		QVERIFY(BaseObject::getGlobalModificationId()!=mod_id);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
@@ -1,6 +1,25 @@
 #include <QApplication>
+#include "pngstreamwritertest.h"
+#include "databaseimporthelpertest.h"
+#include "baseobjecttest.h"
+#include "databasemodeltest.h"
+#include "modelsdiffhelpertest.h"
 
-int main(int, char **)
+int main(int argc, char **argv)
 {
-  return(0);
+  QApplication app(argc, argv);
+  PNGStreamWriterTest png_stream_writer;
+  DatabaseImportHelperTest db_import_helper;
+  BaseObjectTest base_object;
+  DatabaseModelTest db_model;
+  ModelsDiffHelperTest models_diff_helper;
+  int res=0;
+
+  res|=QTest::qExec(&png_stream_writer, argc, argv);
+  res|=QTest::qExec(&db_import_helper, argc, argv);
+  res|=QTest::qExec(&base_object, argc, argv);
+  res|=QTest::qExec(&db_model, argc, argv);
+  res|=QTest::qExec(&models_diff_helper, argc, argv);
+
+  return(res);
 }
@@ -0,0 +1,103 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2015 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "modelsdiffhelpertest.h"
+#include <tuple>
+
+void ModelsDiffHelperTest::createTable(DatabaseModel &model, const QString &name, const QStringList &columns)
+{
+	Table *table=new Table;
+	Column *column=nullptr;
+
+	table->setName(name);
+	table->setSchema(model.getSchema(QString("public")));
+
+	for(QString col_name : columns)
+	{
+		column=new Column;
+		column->setName(col_name);
+		column->setType(PgSQLType(QString("integer")));
+		table->addColumn(column);
+	}
+
+	model.addTable(table);
+}
+
+void ModelsDiffHelperTest::generatesEachDiffInfoOnce(void)
+{
+	DatabaseModel src_model, imp_model;
+	ModelsDiffHelper diff_helper;
+	set<tuple<unsigned, BaseObject *, BaseObject *>> diff_infos;
+	map<unsigned, unsigned> diffs_count, diffs_counter;
+	QStringList generated;
+	QString aborted_msg;
+	unsigned duplicated=0;
+
+	try
+	{
+		src_model.setName(QString("test_db"));
+		src_model.createSystemObjects(true);
+		createTable(src_model, QString("kept"), { QString("id"), QString("value") });
+		createTable(src_model, QString("added"), { QString("id") });
+
+		imp_model.setName(QString("test_db"));
+		imp_model.createSystemObjects(true);
+		createTable(imp_model, QString("kept"), { QString("id") });
+		createTable(imp_model, QString("dropped"), { QString("id") });
+
+		//The diff infos are collected as they are generated since they are destroyed at the end of the process
+		connect(&diff_helper, &ModelsDiffHelper::s_objectsDiffInfoGenerated, [&](ObjectsDiffInfo diff_info){
+			if(!diff_infos.insert(make_tuple(diff_info.getDiffType(), diff_info.getObject(), diff_info.getOldObject())).second)
+				duplicated++;
+
+			diffs_count[diff_info.getDiffType()]++;
+			generated.push_back(QString("%1:%2:%3").arg(diff_info.getDiffType())
+													.arg(BaseObject::getSchemaName(diff_info.getObject()->getObjectType()))
+													.arg(diff_info.getObject()->getName()));
+		});
+
+		//The counters are reset right after the end of the diff so they are read when it finishes
+		connect(&diff_helper, &ModelsDiffHelper::s_diffFinished, [&](){
+			for(unsigned type=ObjectsDiffInfo::CREATE_OBJECT; type < ObjectsDiffInfo::NO_DIFFERENCE; type++)
+				diffs_counter[type]=diff_helper.getDiffTypeCount(type);
+		});
+
+		connect(&diff_helper, &ModelsDiffHelper::s_diffAborted, [&](Exception e){
+			aborted_msg=e.getExceptionsText();
+		});
+
+		diff_helper.setModels(&src_model, &imp_model);
+		diff_helper.diffModels();
+
+		QVERIFY2(aborted_msg.isEmpty(), aborted_msg.toStdString().c_str());
+		QCOMPARE(duplicated, 0u);
+
+		//The counters must match the diff infos actually stored
+		for(unsigned type=ObjectsDiffInfo::CREATE_OBJECT; type < ObjectsDiffInfo::NO_DIFFERENCE; type++)
+			QCOMPARE(diffs_counter[type], diffs_count[type]);
+
+		QVERIFY(generated.contains(QString("%1:table:added").arg(ObjectsDiffInfo::CREATE_OBJECT)));
+		QVERIFY(generated.contains(QString("%1:table:dropped").arg(ObjectsDiffInfo::DROP_OBJECT)));
+		QVERIFY(generated.contains(QString("%1:column:value").arg(ObjectsDiffInfo::CREATE_OBJECT)));
+		QVERIFY(!generated.contains(QString("%1:table:kept").arg(ObjectsDiffInfo::CREATE_OBJECT)));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
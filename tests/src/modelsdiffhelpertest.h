@@ -0,0 +1,42 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2015 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup tests
+\class ModelsDiffHelperTest
+\brief Checks the diff infos generated when comparing two models
+*/
+
+#ifndef MODELS_DIFF_HELPER_TEST_H
+#define MODELS_DIFF_HELPER_TEST_H
+
+#include <QtTest>
+#include "modelsdiffhelper.h"
+
+class ModelsDiffHelperTest: public QObject {
+	private:
+		Q_OBJECT
+
+		//! \brief Creates a table with the specified columns (all of them integer) in the public schema of the model
+		void createTable(DatabaseModel &model, const QString &name, const QStringList &columns);
+
+	private slots:
+		void generatesEachDiffInfoOnce(void);
+};
+
+#endif
@@ -0,0 +1,93 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2015 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "pngstreamwritertest.h"
+#include "exception.h"
+
+void PNGStreamWriterTest::writeImage(const QString &filename, const QImage &image, unsigned band_height)
+{
+	PNGStreamWriter writer;
+	unsigned height=image.height(), rows=0;
+
+	writer.open(filename, image.width(), height);
+
+	//Each band is copied to its own image just like ModelExportHelper does when rendering the scene
+	for(unsigned row=0; row < height; row+=rows)
+	{
+		rows=qMin(band_height, height - row);
+		writer.writeRows(image.copy(0, row, image.width(), rows), rows);
+	}
+
+	writer.close();
+}
+
+void PNGStreamWriterTest::decodesStreamedImage(void)
+{
+	QString filename=tmp_dir.path() + QString("/gradient.png");
+	QImage image(513, 300, QImage::Format_RGB32), decoded;
+
+	for(int y=0; y < image.height(); y++)
+		for(int x=0; x < image.width(); x++)
+			image.setPixel(x, y, qRgb(x % 256, y % 256, (x * y) % 256));
+
+	//The band height doesn't divide the image height so the last band is shorter
+	writeImage(filename, image, 64);
+
+	QVERIFY(decoded.load(filename, "PNG"));
+	QCOMPARE(decoded.size(), image.size());
+	QVERIFY(decoded.convertToFormat(QImage::Format_RGB32)==image);
+}
+
+void PNGStreamWriterTest::compressesPixelData(void)
+{
+	QString filename=tmp_dir.path() + QString("/blank.png");
+	QImage image(2000, 1000, QImage::Format_RGB32), decoded;
+
+	image.fill(Qt::white);
+	writeImage(filename, image, 100);
+
+	//A blank image must be far smaller than the raw (filtered) pixel data
+	QVERIFY(QFileInfo(filename).size() < (image.width() * 3 + 1) * image.height() / 100);
+	QVERIFY(decoded.load(filename, "PNG"));
+	QVERIFY(decoded.convertToFormat(QImage::Format_RGB32)==image);
+}
+
+void PNGStreamWriterTest::rejectsIncompleteImage(void)
+{
+	QString filename=tmp_dir.path() + QString("/incomplete.png");
+	QImage image(100, 50, QImage::Format_RGB32);
+	PNGStreamWriter writer;
+	bool error=false;
+
+	image.fill(Qt::black);
+	writer.open(filename, 100, 100);
+	writer.writeRows(image, 50);
+
+	try
+	{
+		writer.close();
+	}
+	catch(Exception &)
+	{
+		error=true;
+	}
+
+	//Closing before all the rows were written raises an error and discards the partial file
+	QVERIFY(error);
+	QVERIFY(!QFileInfo::exists(filename));
+}
@@ -0,0 +1,47 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2015 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup tests
+\class PNGStreamWriterTest
+\brief Checks that the images streamed band by band by PNGStreamWriter are decoded back to the same pixels
+*/
+
+#ifndef PNG_STREAM_WRITER_TEST_H
+#define PNG_STREAM_WRITER_TEST_H
+
+#include <QtTest>
+#include <QTemporaryDir>
+#include "pngstreamwriter.h"
+
+class PNGStreamWriterTest: public QObject {
+	private:
+		Q_OBJECT
+
+		QTemporaryDir tmp_dir;
+
+		//! \brief Writes the image to the file in bands with the provided height
+		void writeImage(const QString &filename, const QImage &image, unsigned band_height);
+
+	private slots:
+		void decodesStreamedImage(void);
+		void compressesPixelData(void);
+		void rejectsIncompleteImage(void);
+};
+
+#endif
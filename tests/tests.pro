@@ -12,7 +12,20 @@ include(../pgmodeler.pri)
 TEMPLATE = app
 TARGET = tests
 
-SOURCES += $$PWD/src/main.cpp
+QT += testlib
+
+SOURCES += $$PWD/src/main.cpp \
+           $$PWD/src/pngstreamwritertest.cpp \
+           $$PWD/src/databaseimporthelpertest.cpp \
+           $$PWD/src/baseobjecttest.cpp \
+           $$PWD/src/databasemodeltest.cpp \
+           $$PWD/src/modelsdiffhelpertest.cpp
+
+HEADERS += $$PWD/src/pngstreamwritertest.h \
+           $$PWD/src/databaseimporthelpertest.h \
+           $$PWD/src/baseobjecttest.h \
+           $$PWD/src/databasemodeltest.h \
+           $$PWD/src/modelsdiffhelpertest.h
 
 unix|win32: LIBS += -L$$OUT_PWD/../libpgmodeler_ui/ -lpgmodeler_ui \
                     -L$$OUT_PWD/../libobjrenderer/ -lobjrenderer \